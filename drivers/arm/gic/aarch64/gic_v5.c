@@ -36,7 +36,10 @@ static uint16_t iaffids[PLATFORM_CORE_COUNT];
 /* the IST is a power of 2 since that's what goes in IRS_IST_CFGR.LPI_ID_BITS */
 struct l2_iste ist[next_power_of_2(PLATFORM_CORE_COUNT) * IRQ_NUM_SGIS];
 
-static ppi_desc ppi_desc_table[PLATFORM_CORE_COUNT][GICV5_MAX_PPI_ID];
+/* Descriptors of the banked interrupts of each CPU, see irq.h */
+static struct {
+	ppi_desc ppi[GICV5_MAX_PPI_ID];
+} __aligned(CACHE_WRITEBACK_GRANULE) ppi_desc_table[PLATFORM_CORE_COUNT];
 static spi_desc spi_desc_table[PLAT_MAX_SPI_OFFSET_ID];
 static spi_desc lpi_desc_table[PLATFORM_CORE_COUNT * IRQ_NUM_SGIS];
 
@@ -414,21 +417,21 @@ uint32_t gicv5_get_sgi_num(uint32_t index, unsigned int core_pos)
 	return (core_pos * IRQ_NUM_SGIS + index) | INPLACE(INT_TYPE, INT_LPI);
 }
 
-irq_handler_t *gicv5_get_irq_handler(unsigned int irq_num)
+irq_desc_t *gicv5_get_irq_desc(unsigned int irq_num)
 {
 	unsigned int linear_id;
 
 	if (EXTRACT(INT_TYPE, irq_num) == INT_PPI) {
 		linear_id = platform_get_core_pos(read_mpidr_el1());
-		return &ppi_desc_table[linear_id][EXTRACT(INT_ID, irq_num)].handler;
+		return &ppi_desc_table[linear_id].ppi[EXTRACT(INT_ID, irq_num)];
 	}
 
 	if (EXTRACT(INT_TYPE, irq_num) == INT_LPI) {
-		return &lpi_desc_table[EXTRACT(INT_ID, irq_num)].handler;
+		return &lpi_desc_table[EXTRACT(INT_ID, irq_num)];
 	}
 
 	if (EXTRACT(INT_TYPE, irq_num) == INT_SPI) {
-		return &spi_desc_table[EXTRACT(INT_ID, irq_num)].handler;
+		return &spi_desc_table[EXTRACT(INT_ID, irq_num)];
 	}
 
 	/* Interrupt should have been handled */
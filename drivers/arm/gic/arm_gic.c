@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,7 @@
 #include <drivers/arm/gic_v2.h>
 #include <drivers/arm/gic_v3.h>
 #include <drivers/arm/gic_v5.h>
+#include <platform.h>
 
 /* Record whether a GICv3 was detected on the system */
 static unsigned int gicv3_detected;
@@ -164,6 +165,36 @@ void arm_gic_send_sgi(unsigned int sgi_id, unsigned int core_pos)
 		gicv2_send_sgi(sgi_id, core_pos);
 }
 
+void arm_gic_send_sgi_multicast(unsigned int sgi_id, const bool *targets)
+{
+	if (gicv3_detected) {
+		gicv3_send_sgi_multicast(sgi_id, targets);
+	} else if (gicv5_detected) {
+		for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+			if (targets[i])
+				gicv5_send_sgi(sgi_id, i);
+		}
+	} else {
+		gicv2_send_sgi_multicast(sgi_id, targets);
+	}
+}
+
+void arm_gic_send_sgi_others(unsigned int sgi_id)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	if (gicv3_detected) {
+		gicv3_send_sgi_others(sgi_id);
+	} else if (gicv5_detected) {
+		for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+			if (i != core_pos)
+				gicv5_send_sgi(sgi_id, i);
+		}
+	} else {
+		gicv2_send_sgi_others(sgi_id);
+	}
+}
+
 void arm_gic_set_intr_target(unsigned int num, unsigned int core_pos)
 {
 	if (gicv3_detected)
@@ -308,12 +339,12 @@ bool arm_gic_is_espi_supported(void)
 	return false;
 }
 
-irq_handler_t *arm_gic_get_irq_handler(unsigned int irq_num)
+irq_desc_t *arm_gic_get_irq_desc(unsigned int irq_num)
 {
 	if (gicv5_detected) {
-		return gicv5_get_irq_handler(irq_num);
+		return gicv5_get_irq_desc(irq_num);
 	} else {
-		return gicv2v3_get_irq_handler(irq_num);
+		return gicv2v3_get_irq_desc(irq_num);
 	}
 }
 
@@ -322,6 +353,6 @@ bool arm_gic_is_irq_shared(unsigned int irq_num)
 	if (gicv5_detected) {
 		return gicv5_is_irq_spi(irq_num);
 	} else {
-		return gicv2v3_is_irq_spi(irq_num);
+		return gicv2v3_is_irq_spi(irq_num) || IS_LPI(irq_num);
 	}
 }
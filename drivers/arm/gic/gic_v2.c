@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -263,6 +263,40 @@ void gicv2_send_sgi(unsigned int sgi_id, unsigned int core_pos)
 	gicd_write_sgir(gicd_base_addr, sgir_val);
 }
 
+void gicv2_send_sgi_multicast(unsigned int sgi_id, const bool *targets)
+{
+	unsigned int sgir_val, target_list = 0U;
+
+	assert(gicd_base_addr);
+	assert(IS_SGI(sgi_id));
+
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (targets[i])
+			target_list |= 1U << core_pos_to_gic_id(i);
+	}
+
+	if (target_list == 0U)
+		return;
+
+	sgir_val = sgi_id << GICD_SGIR_INTID_SHIFT;
+	sgir_val |= target_list << GICD_SGIR_CPUTL_SHIFT;
+
+	gicd_write_sgir(gicd_base_addr, sgir_val);
+}
+
+void gicv2_send_sgi_others(unsigned int sgi_id)
+{
+	unsigned int sgir_val;
+
+	assert(gicd_base_addr);
+	assert(IS_SGI(sgi_id));
+
+	sgir_val = sgi_id << GICD_SGIR_INTID_SHIFT;
+	sgir_val |= GICD_SGIR_TLF_OTHERS << GICD_SGIR_TLF_SHIFT;
+
+	gicd_write_sgir(gicd_base_addr, sgir_val);
+}
+
 void gicv2_set_itargetsr(unsigned int num, unsigned int core_pos)
 {
 	unsigned int gic_cpu_id;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -205,33 +205,41 @@ bool gicv2v3_is_irq_spi(unsigned int irq_num)
 }
 
 static spi_desc spi_desc_table[PLAT_MAX_SPI_OFFSET_ID + 1];
-static ppi_desc ppi_desc_table[PLATFORM_CORE_COUNT][
-				(MAX_PPI_ID + 1) - MIN_PPI_ID];
-static sgi_desc sgi_desc_table[PLATFORM_CORE_COUNT][MAX_SGI_ID + 1];
+/* LPIs are not banked, their handlers are shared like the SPIs' ones */
+static spi_desc lpi_desc_table[(MAX_LPI_ID + 1) - MIN_LPI_ID];
+/* Descriptors of the banked interrupts of each CPU, see irq.h */
+static struct {
+	ppi_desc ppi[(MAX_PPI_ID + 1) - MIN_PPI_ID];
+	sgi_desc sgi[MAX_SGI_ID + 1];
+} __aligned(CACHE_WRITEBACK_GRANULE) banked_desc_table[PLATFORM_CORE_COUNT];
 static spurious_desc spurious_desc_handler;
 
 void gicv2v3_irq_setup(void)
 {
 	memset(spi_desc_table, 0, sizeof(spi_desc_table));
-	memset(ppi_desc_table, 0, sizeof(ppi_desc_table));
-	memset(sgi_desc_table, 0, sizeof(sgi_desc_table));
+	memset(lpi_desc_table, 0, sizeof(lpi_desc_table));
+	memset(banked_desc_table, 0, sizeof(banked_desc_table));
 	memset(&spurious_desc_handler, 0, sizeof(spurious_desc_handler));
 }
 
-irq_handler_t *gicv2v3_get_irq_handler(unsigned int irq_num)
+irq_desc_t *gicv2v3_get_irq_desc(unsigned int irq_num)
 {
 	if (IS_PLAT_SPI(irq_num)) {
-		return &spi_desc_table[irq_num - MIN_SPI_ID].handler;
+		return &spi_desc_table[irq_num - MIN_SPI_ID];
+	}
+
+	if (IS_LPI(irq_num)) {
+		return &lpi_desc_table[irq_num - MIN_LPI_ID];
 	}
 
 	unsigned int linear_id = platform_get_core_pos(read_mpidr_el1());
 
 	if (IS_PPI(irq_num)) {
-		return &ppi_desc_table[linear_id][irq_num - MIN_PPI_ID].handler;
+		return &banked_desc_table[linear_id].ppi[irq_num - MIN_PPI_ID];
 	}
 
 	if (IS_SGI(irq_num)) {
-		return &sgi_desc_table[linear_id][irq_num - MIN_SGI_ID].handler;
+		return &banked_desc_table[linear_id].sgi[irq_num - MIN_SGI_ID];
 	}
 
 	/*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,7 @@
 #include <drivers/arm/gic_v3.h>
 #include <mmio.h>
 #include <platform.h>
+#include <spinlock.h>
 
 /* Global variables to store the GIC frame list and Distributor base address */
 static const uintptr_t *gicr_frames;
@@ -55,6 +56,27 @@ static uintptr_t rdist_pcpu_base[PLATFORM_CORE_COUNT];
  */
 static unsigned long long mpidr_list[PLATFORM_CORE_COUNT] = {UINT64_MAX};
 
+/*
+ * ICC_SGI1R value targeting each core, without the SGI ID, computed when the
+ * core probes its redistributor.
+ */
+static unsigned long long sgir_target[PLATFORM_CORE_COUNT];
+
+/*
+ * Affinity and base address of the redistributors whose GICR_TYPER has been
+ * read, in the order of the GICR frames. Each core only walks the frames that
+ * no other core has walked yet, rather than all the frames up to its own.
+ */
+static struct {
+	unsigned long long affinity;
+	uintptr_t base;
+} rdist_table[PLATFORM_CORE_COUNT];
+static unsigned int rdist_count;
+/* Frame, and redistributor within it, where the walk resumes */
+static const uintptr_t *rdist_next_frame;
+static uintptr_t rdist_next_base;
+static spinlock_t rdist_lock;
+
 /******************************************************************************
  * GIC Distributor interface accessors for writing entire registers
  *****************************************************************************/
@@ -299,39 +321,37 @@ void gicv3_set_ipriorityr(unsigned int interrupt_id,
 	}
 }
 
-void gicv3_send_sgi(unsigned int sgi_id, unsigned int core_pos)
+/*
+ * Return the ICC_SGI1R value targeting the core with MPIDR `mpid`, without
+ * the SGI ID.
+ */
+static unsigned long long gicv3_sgir_target(unsigned long long mpid)
 {
 	unsigned long long aff0, aff1, aff2;
-	unsigned long long sgir, target_list;
-
-	assert(IS_SGI(sgi_id));
-	assert(core_pos < PLATFORM_CORE_COUNT);
-
-	assert(mpidr_list[core_pos] != UINT64_MAX);
 
-	/* Extract the affinity information */
-	aff0 = MPIDR_AFF_ID(mpidr_list[core_pos], 0);
-	aff1 = MPIDR_AFF_ID(mpidr_list[core_pos], 1);
-	aff2 = MPIDR_AFF_ID(mpidr_list[core_pos], 2);
+	aff0 = MPIDR_AFF_ID(mpid, 0);
+	aff1 = MPIDR_AFF_ID(mpid, 1);
+	aff2 = MPIDR_AFF_ID(mpid, 2);
 #ifdef __aarch64__
 	unsigned long long aff3;
-	aff3 = MPIDR_AFF_ID(mpidr_list[core_pos], 3);
+	aff3 = MPIDR_AFF_ID(mpid, 3);
 #endif
 
 	/* Construct the SGI target list using Affinity 0 */
 	assert(aff0 < SGI_TARGET_MAX_AFF0);
-	target_list = 1 << aff0;
 
-	/* Construct the SGI target affinity */
-	sgir =
+	return
 #ifdef __aarch64__
 		((aff3 & SGI1R_AFF_MASK) << SGI1R_AFF3_SHIFT) |
 #endif
 		((aff2 & SGI1R_AFF_MASK) << SGI1R_AFF2_SHIFT) |
 		((aff1 & SGI1R_AFF_MASK) << SGI1R_AFF1_SHIFT) |
-		((target_list & SGI1R_TARGET_LIST_MASK)
+		(((1ULL << aff0) & SGI1R_TARGET_LIST_MASK)
 				<< SGI1R_TARGET_LIST_SHIFT);
+}
 
+static void gicv3_write_sgir(unsigned int sgi_id, unsigned long long sgir)
+{
 	/* Combine SGI target affinity with the SGI ID */
 	sgir |= ((sgi_id & SGI1R_INTID_MASK) << SGI1R_INTID_SHIFT);
 #ifdef __aarch64__
@@ -339,6 +359,60 @@ void gicv3_send_sgi(unsigned int sgi_id, unsigned int core_pos)
 #else
 	write64_icc_sgi1r(sgir);
 #endif
+}
+
+void gicv3_send_sgi(unsigned int sgi_id, unsigned int core_pos)
+{
+	assert(IS_SGI(sgi_id));
+	assert(core_pos < PLATFORM_CORE_COUNT);
+	assert(sgir_target[core_pos] != 0ULL);
+
+	gicv3_write_sgir(sgi_id, sgir_target[core_pos]);
+	isb();
+}
+
+void gicv3_send_sgi_multicast(unsigned int sgi_id, const bool *targets)
+{
+	const unsigned long long list_mask =
+		(unsigned long long)SGI1R_TARGET_LIST_MASK <<
+		SGI1R_TARGET_LIST_SHIFT;
+	unsigned long long sgir = 0ULL;
+
+	assert(IS_SGI(sgi_id));
+
+	/*
+	 * Accumulate the targets of each cluster in a single target list.
+	 * Cores of a cluster are expected to have consecutive core positions,
+	 * otherwise a cluster just takes more than one write.
+	 */
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (!targets[i])
+			continue;
+
+		assert(sgir_target[i] != 0ULL);
+
+		if ((sgir != 0ULL) &&
+		    ((sgir & ~list_mask) != (sgir_target[i] & ~list_mask))) {
+			gicv3_write_sgir(sgi_id, sgir);
+			sgir = 0ULL;
+		}
+
+		sgir |= sgir_target[i];
+	}
+
+	if (sgir != 0ULL)
+		gicv3_write_sgir(sgi_id, sgir);
+
+	isb();
+}
+
+void gicv3_send_sgi_others(unsigned int sgi_id)
+{
+	assert(IS_SGI(sgi_id));
+
+	/* Interrupt Routing Mode 1 targets all the cores but the sender */
+	gicv3_write_sgir(sgi_id, (unsigned long long)SGI1R_IRM_MASK
+						<< SGI1R_IRM_SHIFT);
 	isb();
 }
 
@@ -443,44 +517,129 @@ void gicv3_set_icpendr(unsigned int interrupt_id)
 		gicd_set_icpendr(gicd_base_addr, interrupt_id);
 }
 
-void gicv3_probe_redistif_addr(void)
+/*
+ * Walk all the GICR frames to find the redistributor with `affinity`. Return
+ * its base address, or 0 if it is not found.
+ */
+static uintptr_t gicv3_walk_redistif(unsigned long long affinity)
 {
 	unsigned long long typer_val;
 	uintptr_t rdistif_base;
 	const uintptr_t *frame;
+
+	for (frame = gicr_frames; *frame != 0U; frame++) {
+		rdistif_base = *frame;
+		do {
+			typer_val = gicr_read_typer(rdistif_base);
+			if (affinity == ((typer_val >> TYPER_AFF_VAL_SHIFT) &
+					 TYPER_AFF_VAL_MASK)) {
+				return rdistif_base;
+			}
+
+			rdistif_base += (1U << GICR_PCPUBASE_SHIFT);
+		} while ((typer_val & TYPER_LAST_BIT) == 0U);
+	}
+
+	return 0U;
+}
+
+/*
+ * Look the redistributor with `affinity` up in rdist_table[], starting with
+ * entry `hint`, then resume the walk of the GICR frames, adding the
+ * redistributors found on the way to the table. Return its base address, or
+ * 0 if it is not found. The caller must hold rdist_lock.
+ */
+static uintptr_t gicv3_lookup_redistif(unsigned long long affinity,
+				       unsigned int hint)
+{
+	unsigned long long typer_val, typer_aff;
+	uintptr_t rdistif_base;
+
+	/* Redistributors are usually laid out in the order of the cores */
+	if ((hint < rdist_count) && (rdist_table[hint].affinity == affinity))
+		return rdist_table[hint].base;
+
+	for (unsigned int i = 0U; i < rdist_count; i++) {
+		if (rdist_table[i].affinity == affinity)
+			return rdist_table[i].base;
+	}
+
+	if (rdist_next_frame == NULL)
+		rdist_next_frame = gicr_frames;
+
+	while (*rdist_next_frame != 0U) {
+		rdistif_base = (rdist_next_base != 0U) ?
+			rdist_next_base : *rdist_next_frame;
+
+		typer_val = gicr_read_typer(rdistif_base);
+		typer_aff = (typer_val >> TYPER_AFF_VAL_SHIFT) &
+			    TYPER_AFF_VAL_MASK;
+
+		if ((typer_val & TYPER_LAST_BIT) != 0U) {
+			rdist_next_frame++;
+			rdist_next_base = 0U;
+		} else {
+			rdist_next_base = rdistif_base +
+					  (1U << GICR_PCPUBASE_SHIFT);
+		}
+
+		if (rdist_count < PLATFORM_CORE_COUNT) {
+			rdist_table[rdist_count].affinity = typer_aff;
+			rdist_table[rdist_count].base = rdistif_base;
+			rdist_count++;
+		}
+
+		if (typer_aff == affinity)
+			return rdistif_base;
+	}
+
+	return 0U;
+}
+
+void gicv3_probe_redistif_addr(void)
+{
 	unsigned long long affinity;
+	unsigned long long mpidr = read_mpidr_el1() & MPIDR_AFFINITY_MASK;
 	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	uintptr_t rdistif_base;
 
 	assert(gicr_frames);
 
 	/*
 	 * Return if the re-distributor base address is already populated
-	 * for this core.
+	 * for this core, i.e. on warm boots.
 	 */
 	if (rdist_pcpu_base[core_pos])
 		return;
 
-	affinity = gic_typer_affinity_from_mpidr(read_mpidr_el1() &
-						 MPIDR_AFFINITY_MASK);
+	affinity = gic_typer_affinity_from_mpidr(mpidr);
 
-	for (frame = gicr_frames; *frame != 0U; frame++) {
-		rdistif_base = *frame;
-		do {
-			typer_val = gicr_read_typer(rdistif_base);
-			if (affinity == ((typer_val >> TYPER_AFF_VAL_SHIFT) &
-					 TYPER_AFF_VAL_MASK)) {
-				rdist_pcpu_base[core_pos] = rdistif_base;
-				mpidr_list[core_pos] = read_mpidr_el1() &
-						       MPIDR_AFFINITY_MASK;
-				return;
-			}
+	spin_lock(&rdist_lock);
+	rdistif_base = gicv3_lookup_redistif(affinity, core_pos);
+	spin_unlock(&rdist_lock);
 
-			rdistif_base += (1U << GICR_PCPUBASE_SHIFT);
-		} while ((typer_val & TYPER_LAST_BIT) == 0U);
+	/*
+	 * The table may hold a stale affinity for a redistributor which was
+	 * powered down when it was read, walk all the frames again.
+	 */
+	if (rdistif_base == 0U)
+		rdistif_base = gicv3_walk_redistif(affinity);
+
+	if (rdistif_base == 0U) {
+		ERROR("Re-distributor address not found for core %d\n", core_pos);
+		panic();
 	}
 
-	ERROR("Re-distributor address not found for core %d\n", core_pos);
-	panic();
+	rdist_pcpu_base[core_pos] = rdistif_base;
+	mpidr_list[core_pos] = mpidr;
+	sgir_target[core_pos] = gicv3_sgir_target(mpidr);
+}
+
+uintptr_t gicv3_get_redistif_base(unsigned int core_pos)
+{
+	assert(core_pos < PLATFORM_CORE_COUNT);
+
+	return rdist_pcpu_base[core_pos];
 }
 
 void gicv3_setup_distif(void)
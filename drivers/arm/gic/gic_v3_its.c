@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <arch.h>
+#include <arch_helpers.h>
+#include <assert.h>
+#include <cassert.h>
+#include <cdefs.h>
+#include <common_def.h>
+#include <debug.h>
+#include <drivers/arm/gic_v2v3_common.h>
+#include <drivers/arm/gic_v3.h>
+#include <drivers/arm/gic_v3_its.h>
+#include <mmio.h>
+#include <platform.h>
+#include <spinlock.h>
+#include <stdbool.h>
+#include <string.h>
+#include <utils_def.h>
+
+/*
+ * Minimal driver for a single GICv3 ITS, with flat device and collection
+ * tables and one collection per core.
+ *
+ * The LPI configuration and pending tables are sized for the smallest LPI ID
+ * space (14 bits), which is enough for the LPIs from MIN_LPI_ID to MAX_LPI_ID
+ * that the driver uses.
+ * Commands are issued under a lock and, except for INT, the driver waits for
+ * the ITS to process them before returning.
+ */
+
+#define LPI_ID_BITS		14U
+#define NUM_LPIS		((MAX_LPI_ID + 1) - MIN_LPI_ID)
+
+/* One byte per LPI, from MIN_LPI_ID */
+#define LPI_PROP_TABLE_SIZE	((1U << LPI_ID_BITS) - MIN_LPI_ID)
+/* One bit per interrupt ID, including the ones below MIN_LPI_ID */
+#define LPI_PEND_TABLE_SIZE	((1U << LPI_ID_BITS) / 8U)
+
+#define ITS_CMD_SIZE		32U
+#define ITS_CMD_QUEUE_SIZE	SZ_4K
+/* Large enough for one page of any size the ITS may require */
+#define ITS_TABLE_SIZE		SZ_64K
+/* ITT entries are at most 16 bytes */
+#define ITS_ITT_SIZE		(NUM_LPIS * 16U)
+#define ITS_ITT_ALIGN		256U
+
+/* Address fields of the GIC tables and of the ITS command arguments */
+#define GIC_TABLE_ADDR_MASK	GENMASK_64(51, 12)
+#define ITS_RDBASE_MASK		GENMASK_64(51, 16)
+#define ITS_ITT_ADDR_MASK	GENMASK_64(51, 8)
+#define ITS_CMD_VALID		BIT_64(63)
+
+/*
+ * GICR_PENDBASER requires 64KB alignment, so the pending table of each core
+ * starts a 64KB slot, although it only takes LPI_PEND_TABLE_SIZE bytes. The
+ * ITS memory which isn't per core lives in the rest of the slot of core 0
+ * rather than in padding of its own.
+ */
+struct its_mem_slot {
+	uint8_t pend_table[LPI_PEND_TABLE_SIZE];
+	/* Only used in the slot of core 0 */
+	uint8_t prop_table[LPI_PROP_TABLE_SIZE] __aligned(SZ_4K);
+	uint8_t cmd_queue[ITS_CMD_QUEUE_SIZE] __aligned(SZ_4K);
+	uint8_t itts[GICV3_ITS_MAX_DEVICES][ITS_ITT_SIZE]
+		__aligned(ITS_ITT_ALIGN);
+} __aligned(SZ_64K);
+
+CASSERT(sizeof(struct its_mem_slot) == SZ_64K, assert_its_mem_slot_size);
+
+static struct its_mem_slot its_mem[PLATFORM_CORE_COUNT];
+
+static uint8_t its_device_table[ITS_TABLE_SIZE] __aligned(SZ_64K);
+static uint8_t its_collection_table[ITS_TABLE_SIZE] __aligned(SZ_64K);
+
+static struct {
+	uintptr_t base;
+	/* The tables are not coherent with the ITS, clean them after writes */
+	bool flush;
+	/* Collection targets are addresses rather than processor numbers */
+	bool pta;
+	unsigned int ite_size;
+	unsigned int event_id_bits;
+	uint32_t num_device_ids;
+	/* Offset of the next command in the queue */
+	uint64_t cmd_write;
+	/* Value of the RDbase field of the commands targeting each core */
+	uint64_t rd_target[PLATFORM_CORE_COUNT];
+	bool collection_mapped[PLATFORM_CORE_COUNT];
+} its;
+
+static struct {
+	bool mapped;
+	uint32_t id;
+	unsigned int num_events;
+} its_devices[GICV3_ITS_MAX_DEVICES];
+
+static struct {
+	bool mapped;
+	uint32_t device_id;
+	uint32_t event_id;
+	unsigned int core_pos;
+} its_lpis[NUM_LPIS];
+
+static spinlock_t its_lock;
+
+static bool gic_attr_non_shareable(uint64_t baser, unsigned int shift)
+{
+	return ((baser >> shift) & GITS_BASER_SHAREABILITY_MASK) == 0U;
+}
+
+/******************************************************************************
+ * ITS command queue. The caller must hold its_lock.
+ *****************************************************************************/
+static void its_send_cmd(uint64_t dw0, uint64_t dw1, uint64_t dw2)
+{
+	uint64_t next = (its.cmd_write + ITS_CMD_SIZE) % ITS_CMD_QUEUE_SIZE;
+	uint64_t *cmd = (uint64_t *)&its_mem[0].cmd_queue[its.cmd_write];
+
+	/* Wait for the ITS to make room in the queue if it is full */
+	while (next == (mmio_read_64(its.base + GITS_CREADR) &
+			GITS_CMD_OFFSET_MASK))
+		;
+
+	cmd[0] = dw0;
+	cmd[1] = dw1;
+	cmd[2] = dw2;
+	cmd[3] = 0U;
+
+	/* The command must be visible to the ITS before CWRITER moves on */
+	if (its.flush)
+		flush_dcache_range((uintptr_t)cmd, ITS_CMD_SIZE);
+	else
+		dsbishst();
+
+	its.cmd_write = next;
+	mmio_write_64(its.base + GITS_CWRITER, next);
+}
+
+static void its_wait_for_cmds(void)
+{
+	uint64_t creadr;
+
+	do {
+		creadr = mmio_read_64(its.base + GITS_CREADR);
+		if ((creadr & GITS_CREADR_STALLED) != 0U) {
+			ERROR("ITS command queue stalled at 0x%llx\n",
+			      (unsigned long long)(creadr & GITS_CMD_OFFSET_MASK));
+			panic();
+		}
+	} while ((creadr & GITS_CMD_OFFSET_MASK) != its.cmd_write);
+}
+
+/* Wait for the effects of the previous commands on `core_pos` */
+static void its_sync(unsigned int core_pos)
+{
+	its_send_cmd(GITS_CMD_SYNC, 0U, its.rd_target[core_pos]);
+	its_wait_for_cmds();
+}
+
+/******************************************************************************
+ * ITS setup
+ *****************************************************************************/
+static int its_setup_baser(uintptr_t its_base, unsigned int n)
+{
+	uint64_t baser = mmio_read_64(its_base + GITS_BASER(n));
+	uint64_t type = (baser >> GITS_BASER_TYPE_SHIFT) & GITS_BASER_TYPE_MASK;
+	uint64_t entry_size = ((baser >> GITS_BASER_ENTRY_SIZE_SHIFT) &
+			       GITS_BASER_ENTRY_SIZE_MASK) + 1U;
+	uint8_t *table;
+
+	if (type == GITS_BASER_TYPE_DEVICE) {
+		table = its_device_table;
+	} else if (type == GITS_BASER_TYPE_COLLECTION) {
+		table = its_collection_table;
+	} else {
+		/* No memory needed, or the table is for virtual LPIs */
+		return 0;
+	}
+
+	/* The ITS expects the table to be zeroed */
+	memset(table, 0, ITS_TABLE_SIZE);
+	flush_dcache_range((uintptr_t)table, ITS_TABLE_SIZE);
+
+	/* Try 4KB, 16KB and 64KB pages, the ITS may only support some */
+	for (uint64_t psz = 0U; psz <= 2U; psz++) {
+		unsigned int page_size = SZ_4K << (2U * psz);
+
+		baser = ((uintptr_t)table & GIC_TABLE_ADDR_MASK) |
+			GITS_BASER_VALID |
+			(type << GITS_BASER_TYPE_SHIFT) |
+			((entry_size - 1U) << GITS_BASER_ENTRY_SIZE_SHIFT) |
+			(GIC_BASER_CACHE_RAWAWB << GITS_BASER_INNER_CACHE_SHIFT) |
+			(GIC_BASER_INNER_SHAREABLE <<
+			 GITS_BASER_SHAREABILITY_SHIFT) |
+			(psz << GITS_BASER_PAGE_SIZE_SHIFT) |
+			((ITS_TABLE_SIZE / page_size) - 1U);
+		mmio_write_64(its_base + GITS_BASER(n), baser);
+
+		baser = mmio_read_64(its_base + GITS_BASER(n));
+		if (((baser >> GITS_BASER_PAGE_SIZE_SHIFT) &
+		     GITS_BASER_PAGE_SIZE_MASK) != psz)
+			continue;
+
+		if (gic_attr_non_shareable(baser,
+					   GITS_BASER_SHAREABILITY_SHIFT))
+			its.flush = true;
+
+		if (type == GITS_BASER_TYPE_DEVICE)
+			its.num_device_ids = ITS_TABLE_SIZE / entry_size;
+
+		return 0;
+	}
+
+	ERROR("ITS: no supported page size for table %u\n", n);
+	return -1;
+}
+
+int gicv3_its_init(uintptr_t its_base)
+{
+	unsigned int gicd_typer = gicv3_get_gicd_typer();
+	unsigned int dev_bits;
+	uint64_t typer, cbaser;
+	int ret = -1;
+
+	assert(its_base != 0U);
+
+	if ((gicd_typer & TYPER_LPIS) == 0U) {
+		ERROR("ITS: the GIC does not support LPIs\n");
+		return -1;
+	}
+
+	assert((((gicd_typer >> TYPER_IDBITS_SHIFT) & TYPER_IDBITS_MASK) + 1U)
+	       >= LPI_ID_BITS);
+
+	spin_lock(&its_lock);
+
+	if (its.base != 0U) {
+		ret = (its.base == its_base) ? 0 : -1;
+		goto out;
+	}
+
+	if ((mmio_read_32(its_base + GITS_CTLR) & GITS_CTLR_ENABLED) != 0U) {
+		ERROR("ITS: already enabled\n");
+		goto out;
+	}
+
+	while ((mmio_read_32(its_base + GITS_CTLR) & GITS_CTLR_QUIESCENT) == 0U)
+		;
+
+	typer = mmio_read_64(its_base + GITS_TYPER);
+	if ((typer & GITS_TYPER_PHYSICAL) == 0U) {
+		ERROR("ITS: physical LPIs not supported\n");
+		goto out;
+	}
+
+	its.ite_size = ((typer >> GITS_TYPER_ITT_ENTRY_SIZE_SHIFT) &
+			GITS_TYPER_ITT_ENTRY_SIZE_MASK) + 1U;
+	its.event_id_bits = ((typer >> GITS_TYPER_IDBITS_SHIFT) &
+			     GITS_TYPER_IDBITS_MASK) + 1U;
+	its.pta = (typer & GITS_TYPER_PTA) != 0U;
+	assert(its.ite_size * NUM_LPIS <= ITS_ITT_SIZE);
+
+	for (unsigned int n = 0U; n < GITS_BASER_NUM; n++) {
+		if (its_setup_baser(its_base, n) != 0)
+			goto out;
+	}
+
+	/* Device IDs are limited by both the table and the ITS */
+	dev_bits = ((typer >> GITS_TYPER_DEVBITS_SHIFT) &
+		    GITS_TYPER_DEVBITS_MASK) + 1U;
+	if (dev_bits < 32U)
+		its.num_device_ids = MIN(its.num_device_ids, 1U << dev_bits);
+
+	memset(its_mem[0].cmd_queue, 0, sizeof(its_mem[0].cmd_queue));
+	flush_dcache_range((uintptr_t)its_mem[0].cmd_queue,
+			   sizeof(its_mem[0].cmd_queue));
+
+	cbaser = ((uintptr_t)its_mem[0].cmd_queue & GIC_TABLE_ADDR_MASK) |
+		 GITS_BASER_VALID |
+		 (GIC_BASER_CACHE_RAWAWB << GITS_BASER_INNER_CACHE_SHIFT) |
+		 (GIC_BASER_INNER_SHAREABLE << GITS_BASER_SHAREABILITY_SHIFT) |
+		 ((ITS_CMD_QUEUE_SIZE / SZ_4K) - 1U);
+	mmio_write_64(its_base + GITS_CBASER, cbaser);
+	cbaser = mmio_read_64(its_base + GITS_CBASER);
+	if (gic_attr_non_shareable(cbaser, GITS_BASER_SHAREABILITY_SHIFT))
+		its.flush = true;
+
+	its.cmd_write = 0U;
+	mmio_write_64(its_base + GITS_CWRITER, 0U);
+
+	its.base = its_base;
+	mmio_write_32(its_base + GITS_CTLR,
+		      mmio_read_32(its_base + GITS_CTLR) | GITS_CTLR_ENABLED);
+
+	INFO("ITS enabled at 0x%lx\n", its_base);
+	ret = 0;
+out:
+	spin_unlock(&its_lock);
+	return ret;
+}
+
+int gicv3_its_setup_local(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	uintptr_t rdist = gicv3_get_redistif_base(core_pos);
+	uintptr_t pend_table = (uintptr_t)its_mem[core_pos].pend_table;
+	bool non_shareable = false;
+	uint64_t typer, baser;
+	unsigned int ctlr;
+
+	assert(its.base != 0U);
+	assert(rdist != 0U);
+
+	typer = mmio_read_64(rdist + GICR_TYPER);
+	if ((typer & GICR_TYPER_PLPIS) == 0U) {
+		ERROR("ITS: no LPI support in Re-distributor of core %u\n",
+		      core_pos);
+		return -1;
+	}
+
+	ctlr = mmio_read_32(rdist + GICR_CTLR);
+	if ((ctlr & GICR_CTLR_ENABLE_LPIS) != 0U) {
+		/*
+		 * LPIs stay enabled until the core is powered down, but they
+		 * can't be re-enabled with other tables.
+		 */
+		baser = mmio_read_64(rdist + GICR_PROPBASER);
+		if ((baser & GIC_TABLE_ADDR_MASK) !=
+		    (uintptr_t)its_mem[0].prop_table) {
+			ERROR("ITS: LPIs already enabled on core %u\n",
+			      core_pos);
+			return -1;
+		}
+	} else {
+		memset((void *)pend_table, 0, LPI_PEND_TABLE_SIZE);
+		flush_dcache_range(pend_table, LPI_PEND_TABLE_SIZE);
+
+		baser = (uintptr_t)its_mem[0].prop_table |
+			(GIC_BASER_CACHE_RAWAWB <<
+			 GICR_BASER_INNER_CACHE_SHIFT) |
+			(GIC_BASER_INNER_SHAREABLE <<
+			 GICR_BASER_SHAREABILITY_SHIFT) |
+			(LPI_ID_BITS - 1U);
+		mmio_write_64(rdist + GICR_PROPBASER, baser);
+		baser = mmio_read_64(rdist + GICR_PROPBASER);
+		non_shareable = gic_attr_non_shareable(baser,
+					GICR_BASER_SHAREABILITY_SHIFT);
+
+		mmio_write_64(rdist + GICR_PENDBASER, pend_table |
+			      (GIC_BASER_CACHE_RAWAWB <<
+			       GICR_BASER_INNER_CACHE_SHIFT) |
+			      (GIC_BASER_INNER_SHAREABLE <<
+			       GICR_BASER_SHAREABILITY_SHIFT) |
+			      GICR_PENDBASER_PTZ);
+		dsbsy();
+
+		mmio_write_32(rdist + GICR_CTLR, ctlr | GICR_CTLR_ENABLE_LPIS);
+		dsbsy();
+	}
+
+	spin_lock(&its_lock);
+
+	/* Other cores may be using its.flush to issue commands */
+	if (non_shareable)
+		its.flush = true;
+
+	if (its.pta) {
+		its.rd_target[core_pos] = rdist & ITS_RDBASE_MASK;
+	} else {
+		its.rd_target[core_pos] = ((typer >> TYPER_PROC_NUM_SHIFT) &
+					   TYPER_PROC_NUM_MASK) << 16;
+	}
+
+	/* MAPC: the collection with the core position as ID */
+	its_send_cmd(GITS_CMD_MAPC, 0U,
+		     ITS_CMD_VALID | its.rd_target[core_pos] | core_pos);
+	its_sync(core_pos);
+	its.collection_mapped[core_pos] = true;
+
+	spin_unlock(&its_lock);
+
+	return 0;
+}
+
+/******************************************************************************
+ * Devices and LPIs
+ *****************************************************************************/
+static int its_find_device(uint32_t device_id)
+{
+	for (unsigned int i = 0U; i < GICV3_ITS_MAX_DEVICES; i++) {
+		if (its_devices[i].mapped && (its_devices[i].id == device_id))
+			return (int)i;
+	}
+
+	return -1;
+}
+
+int gicv3_its_map_device(uint32_t device_id, unsigned int num_events)
+{
+	unsigned int event_bits = 1U;
+	int slot;
+	int ret = -1;
+
+	assert(its.base != 0U);
+
+	/* The ITT size is a power of 2, of at least 2 entries */
+	while ((1U << event_bits) < num_events)
+		event_bits++;
+
+	if (((1U << event_bits) > NUM_LPIS) ||
+	    (event_bits > its.event_id_bits) ||
+	    (device_id >= its.num_device_ids)) {
+		ERROR("ITS: can't map device 0x%x with %u events\n",
+		      device_id, num_events);
+		return -1;
+	}
+
+	spin_lock(&its_lock);
+
+	slot = its_find_device(device_id);
+	if (slot >= 0) {
+		ret = (its_devices[slot].num_events >= num_events) ? 0 : -1;
+		goto out;
+	}
+
+	for (slot = 0; slot < (int)GICV3_ITS_MAX_DEVICES; slot++) {
+		if (!its_devices[slot].mapped)
+			break;
+	}
+
+	if (slot == (int)GICV3_ITS_MAX_DEVICES) {
+		ERROR("ITS: too many devices mapped\n");
+		goto out;
+	}
+
+	memset(its_mem[0].itts[slot], 0, ITS_ITT_SIZE);
+	flush_dcache_range((uintptr_t)its_mem[0].itts[slot], ITS_ITT_SIZE);
+
+	its_send_cmd(GITS_CMD_MAPD | ((uint64_t)device_id << 32),
+		     event_bits - 1U,
+		     ITS_CMD_VALID |
+		     ((uintptr_t)its_mem[0].itts[slot] & ITS_ITT_ADDR_MASK));
+	its_wait_for_cmds();
+
+	its_devices[slot].mapped = true;
+	its_devices[slot].id = device_id;
+	its_devices[slot].num_events = 1U << event_bits;
+	ret = 0;
+out:
+	spin_unlock(&its_lock);
+	return ret;
+}
+
+void gicv3_its_unmap_device(uint32_t device_id)
+{
+	int slot;
+
+	spin_lock(&its_lock);
+
+	slot = its_find_device(device_id);
+	if (slot < 0) {
+		spin_unlock(&its_lock);
+		return;
+	}
+
+	its_send_cmd(GITS_CMD_MAPD | ((uint64_t)device_id << 32), 0U, 0U);
+	its_wait_for_cmds();
+
+	for (unsigned int i = 0U; i < NUM_LPIS; i++) {
+		if (its_lpis[i].mapped && (its_lpis[i].device_id == device_id))
+			its_lpis[i].mapped = false;
+	}
+
+	its_devices[slot].mapped = false;
+
+	spin_unlock(&its_lock);
+}
+
+int gicv3_its_map_lpi(uint32_t device_id, uint32_t event_id, unsigned int lpi,
+		      unsigned int core_pos)
+{
+	int slot;
+	int ret = -1;
+
+	assert(IS_LPI(lpi));
+	assert(core_pos < PLATFORM_CORE_COUNT);
+
+	spin_lock(&its_lock);
+
+	slot = its_find_device(device_id);
+	if ((slot < 0) || (event_id >= its_devices[slot].num_events) ||
+	    its_lpis[lpi - MIN_LPI_ID].mapped ||
+	    !its.collection_mapped[core_pos]) {
+		ERROR("ITS: can't map event %u of device 0x%x to LPI %u\n",
+		      event_id, device_id, lpi);
+		goto out;
+	}
+
+	its_send_cmd(GITS_CMD_MAPTI | ((uint64_t)device_id << 32),
+		     event_id | ((uint64_t)lpi << 32), core_pos);
+	its_sync(core_pos);
+
+	its_lpis[lpi - MIN_LPI_ID].mapped = true;
+	its_lpis[lpi - MIN_LPI_ID].device_id = device_id;
+	its_lpis[lpi - MIN_LPI_ID].event_id = event_id;
+	its_lpis[lpi - MIN_LPI_ID].core_pos = core_pos;
+	ret = 0;
+out:
+	spin_unlock(&its_lock);
+	return ret;
+}
+
+void gicv3_its_route_lpi(unsigned int lpi, unsigned int core_pos)
+{
+	assert(IS_LPI(lpi));
+	assert(its_lpis[lpi - MIN_LPI_ID].mapped);
+	assert(core_pos < PLATFORM_CORE_COUNT);
+	assert(its.collection_mapped[core_pos]);
+
+	spin_lock(&its_lock);
+
+	its_send_cmd(GITS_CMD_MOVI |
+		     ((uint64_t)its_lpis[lpi - MIN_LPI_ID].device_id << 32),
+		     its_lpis[lpi - MIN_LPI_ID].event_id, core_pos);
+	its_sync(its_lpis[lpi - MIN_LPI_ID].core_pos);
+	its_lpis[lpi - MIN_LPI_ID].core_pos = core_pos;
+
+	spin_unlock(&its_lock);
+}
+
+static void its_set_lpi_config(unsigned int lpi, uint8_t config)
+{
+	uint8_t *entry = &its_mem[0].prop_table[lpi - MIN_LPI_ID];
+
+	assert(IS_LPI(lpi));
+	assert(its_lpis[lpi - MIN_LPI_ID].mapped);
+
+	spin_lock(&its_lock);
+
+	*entry = config;
+	if (its.flush)
+		flush_dcache_range((uintptr_t)entry, sizeof(*entry));
+	else
+		dsbishst();
+
+	/* The Re-distributor may have cached the previous configuration */
+	its_send_cmd(GITS_CMD_INV |
+		     ((uint64_t)its_lpis[lpi - MIN_LPI_ID].device_id << 32),
+		     its_lpis[lpi - MIN_LPI_ID].event_id, 0U);
+	its_sync(its_lpis[lpi - MIN_LPI_ID].core_pos);
+
+	spin_unlock(&its_lock);
+}
+
+void gicv3_its_lpi_enable(unsigned int lpi, unsigned int priority)
+{
+	its_set_lpi_config(lpi, (priority & LPI_PROP_PRIORITY_MASK) |
+			   LPI_PROP_RES1 | LPI_PROP_ENABLE);
+}
+
+void gicv3_its_lpi_disable(unsigned int lpi)
+{
+	its_set_lpi_config(lpi, (its_mem[0].prop_table[lpi - MIN_LPI_ID] &
+				 LPI_PROP_PRIORITY_MASK) | LPI_PROP_RES1);
+}
+
+void gicv3_its_inject_lpi(unsigned int lpi)
+{
+	assert(IS_LPI(lpi));
+	assert(its_lpis[lpi - MIN_LPI_ID].mapped);
+
+	spin_lock(&its_lock);
+	its_send_cmd(GITS_CMD_INT |
+		     ((uint64_t)its_lpis[lpi - MIN_LPI_ID].device_id << 32),
+		     its_lpis[lpi - MIN_LPI_ID].event_id, 0U);
+	spin_unlock(&its_lock);
+}
+
+uintptr_t gicv3_its_get_translater(void)
+{
+	assert(its.base != 0U);
+
+	return its.base + GITS_TRANSLATER;
+}
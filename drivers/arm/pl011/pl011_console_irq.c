@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <arch_helpers.h>
+#include <assert.h>
+#include <cassert.h>
+#include <drivers/arm/arm_gic.h>
+#include <drivers/arm/pl011.h>
+#include <irq.h>
+#include <mmio.h>
+#include <spinlock.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Interrupt-driven transmit path for the PL011 console.
+ *
+ * Instead of waiting for room in the transmit FIFO for every character,
+ * console_pl011_irq_putc() queues characters in a ring buffer and fills the
+ * FIFO with as many of them as it can take. When characters are left over,
+ * the transmit interrupt is unmasked and its handler refills the FIFO once it
+ * has drained below the trigger level.
+ *
+ * The interrupt only speeds things up: every call to the putc function also
+ * moves characters to the FIFO, and the ring buffer is drained synchronously
+ * when it is full, when the caller runs with interrupts masked (exception
+ * handlers, panic) and from console_flush(). The latter is called before
+ * powering down a CPU, so the interrupt is never left pending on it. The
+ * assembly crash path uses console_pl011_irq_crash_drain() instead.
+ */
+
+struct pl011_tx_state {
+	uintptr_t base;
+	/* Free-running indexes, the buffer is empty when they are equal. */
+	unsigned int head;
+	unsigned int tail;
+	char buf[PL011_TX_BUF_SIZE];
+	spinlock_t lock;
+	bool enabled;
+};
+
+CASSERT((PL011_TX_BUF_SIZE & (PL011_TX_BUF_SIZE - 1)) == 0,
+	assert_pl011_tx_buf_size_power_of_2);
+CASSERT(offsetof(struct pl011_tx_state, base) == PL011_TX_STATE_BASE,
+	assert_pl011_tx_state_base_offset_mismatch);
+CASSERT(offsetof(struct pl011_tx_state, head) == PL011_TX_STATE_HEAD,
+	assert_pl011_tx_state_head_offset_mismatch);
+CASSERT(offsetof(struct pl011_tx_state, tail) == PL011_TX_STATE_TAIL,
+	assert_pl011_tx_state_tail_offset_mismatch);
+CASSERT(offsetof(struct pl011_tx_state, buf) == PL011_TX_STATE_BUF,
+	assert_pl011_tx_state_buf_offset_mismatch);
+
+/* Not static, used by console_pl011_irq_crash_drain(). */
+struct pl011_tx_state pl011_tx;
+
+static bool pl011_tx_buf_empty(void)
+{
+	return pl011_tx.head == pl011_tx.tail;
+}
+
+/*
+ * Move as many characters as possible from the ring buffer to the transmit
+ * FIFO. The transmit interrupt is left unmasked only if characters are still
+ * queued, in which case the FIFO has been filled above the trigger level.
+ *
+ * The caller must hold the lock.
+ */
+static void pl011_tx_fill(void)
+{
+	uintptr_t base = pl011_tx.base;
+
+	while (!pl011_tx_buf_empty() &&
+	       ((mmio_read_32(base + UARTFR) & PL011_UARTFR_TXFF) == 0U)) {
+		mmio_write_32(base + UARTDR,
+			(unsigned char)pl011_tx.buf[pl011_tx.tail &
+						    (PL011_TX_BUF_SIZE - 1U)]);
+		pl011_tx.tail++;
+	}
+
+	if (pl011_tx_buf_empty()) {
+		mmio_write_32(base + UARTIMSC,
+			mmio_read_32(base + UARTIMSC) & ~PL011_UARTIMSC_TXIM);
+	} else {
+		mmio_write_32(base + UARTIMSC,
+			mmio_read_32(base + UARTIMSC) | PL011_UARTIMSC_TXIM);
+	}
+}
+
+/* The caller must hold the lock. */
+static void pl011_tx_push(char c)
+{
+	/* Wait for the UART to make room in the buffer if it is full. */
+	while ((pl011_tx.head - pl011_tx.tail) == PL011_TX_BUF_SIZE) {
+		pl011_tx_fill();
+	}
+
+	pl011_tx.buf[pl011_tx.head & (PL011_TX_BUF_SIZE - 1U)] = c;
+	pl011_tx.head++;
+}
+
+/* The caller must hold the lock. */
+static void pl011_tx_drain_locked(void)
+{
+	while (!pl011_tx_buf_empty()) {
+		pl011_tx_fill();
+	}
+}
+
+static int pl011_tx_irq_handler(void *data)
+{
+	(void)data;
+
+	spin_lock(&pl011_tx.lock);
+	mmio_write_32(pl011_tx.base + UARTICR, PL011_UARTICR_TXIC);
+	pl011_tx_fill();
+	spin_unlock(&pl011_tx.lock);
+
+	return 0;
+}
+
+int console_pl011_irq_putc(int c)
+{
+	u_register_t flags;
+
+	if (!pl011_tx.enabled) {
+		return console_pl011_putc(c);
+	}
+
+	flags = read_daif();
+
+	if ((flags & (DAIF_IRQ_BIT << SPSR_DAIF_SHIFT)) != 0U) {
+		/*
+		 * The interrupt can't be taken, write the character
+		 * synchronously after whatever is still queued.
+		 *
+		 * We may be running in an exception handler that interrupted
+		 * the owner of the lock on this CPU, so don't wait for it. If
+		 * the lock is busy, write the character straight away; it can
+		 * only end up out of order with what is queued.
+		 */
+		if (spin_trylock(&pl011_tx.lock) == 0) {
+			return console_core_putc(c, pl011_tx.base);
+		}
+
+		pl011_tx_drain_locked();
+		c = console_core_putc(c, pl011_tx.base);
+		spin_unlock(&pl011_tx.lock);
+
+		return c;
+	}
+
+	/* The interrupt handler must not preempt us while we hold the lock. */
+	disable_irq();
+	spin_lock(&pl011_tx.lock);
+
+	/* Prepend '\r' to '\n', like the synchronous path does. */
+	if (c == '\n') {
+		pl011_tx_push('\r');
+	}
+	pl011_tx_push((char)c);
+	pl011_tx_fill();
+
+	spin_unlock(&pl011_tx.lock);
+	write_daif(flags);
+
+	return c;
+}
+
+void console_pl011_irq_drain(void)
+{
+	u_register_t flags;
+
+	if (!pl011_tx.enabled) {
+		return;
+	}
+
+	flags = read_daif();
+	disable_irq();
+	spin_lock(&pl011_tx.lock);
+	pl011_tx_drain_locked();
+	spin_unlock(&pl011_tx.lock);
+	write_daif(flags);
+}
+
+/*
+ * Switch the console at 'base_addr' to interrupt-driven transmission, using
+ * interrupt 'irq_num'. Must be called on the lead CPU after the GIC has been
+ * set up, as the interrupt is targeted at the calling CPU.
+ *
+ * Return 0 on success, a negative value otherwise.
+ */
+int console_pl011_irq_init(uintptr_t base_addr, unsigned int irq_num)
+{
+	uint32_t ifls;
+	int ret;
+
+	assert(base_addr != 0U);
+	assert(!pl011_tx.enabled);
+
+	pl011_tx.base = base_addr;
+
+	mmio_write_32(base_addr + UARTIMSC,
+		mmio_read_32(base_addr + UARTIMSC) & ~PL011_UARTIMSC_TXIM);
+	mmio_write_32(base_addr + UARTICR, PL011_UARTICR_TXIC);
+
+	ifls = mmio_read_32(base_addr + UARTIFLS);
+	ifls &= ~PL011_UARTIFLS_TXIFLSEL_MASK;
+	mmio_write_32(base_addr + UARTIFLS, ifls | PL011_UARTIFLS_TX_1_4);
+
+	ret = tftf_irq_register_handler(irq_num, pl011_tx_irq_handler);
+	if (ret != 0) {
+		return ret;
+	}
+
+	tftf_irq_enable(irq_num, GIC_LOWEST_NS_PRIORITY);
+
+	pl011_tx.enabled = true;
+	dsbish();
+
+	return 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  * Copyright (c) 2024, 2026, Linaro Limited.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -73,13 +73,34 @@ void private_timer_restore(void)
 	write_cnthp_ctl_el2(pcpu_timer_context[linear_id].ctl);
 }
 
+/*
+ * Program arm generic timer to fire an interrupt when the system counter
+ * reaches deadline. A deadline in the past fires immediately.
+ */
+int arm_gen_timer_program_deadline(unsigned long long deadline)
+{
+	unsigned int cntp_ctl;
+
+	write_cntp_cval_el0(deadline);
+
+	/* Enable the timer */
+	cntp_ctl = read_cntp_ctl_el0();
+	set_cntp_ctl_enable(cntp_ctl);
+	clr_cntp_ctl_imask(cntp_ctl);
+	write_cntp_ctl_el0(cntp_ctl);
+
+	VERBOSE("%s : interrupt requested at sys_counter: %llu\n", __func__,
+		deadline);
+
+	return 0;
+}
+
 /*
  * Program arm generic timer to fire and interrupt after time_out_ms
  * milliseconds.
  */
 int arm_gen_timer_program(unsigned long time_out_ms)
 {
-	unsigned int cntp_ctl;
 	unsigned long long count_val;
 	unsigned int freq;
 
@@ -95,18 +116,7 @@ int arm_gen_timer_program(unsigned long time_out_ms)
 	if (count_val < read_cntpct_el0())
 		return -1;
 
-	write_cntp_cval_el0(count_val);
-
-	/* Enable the timer */
-	cntp_ctl = read_cntp_ctl_el0();
-	set_cntp_ctl_enable(cntp_ctl);
-	clr_cntp_ctl_imask(cntp_ctl);
-	write_cntp_ctl_el0(cntp_ctl);
-
-	VERBOSE("%s : interrupt requested at sys_counter: %llu "
-		"time_out_ms: %ld\n", __func__, count_val, time_out_ms);
-
-	return 0;
+	return arm_gen_timer_program_deadline(count_val);
 }
 
 static void disable_gentimer(void)
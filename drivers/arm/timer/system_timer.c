@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -16,19 +16,14 @@
 
 static uintptr_t g_systimer_base;
 
-int program_systimer(unsigned long time_out_ms)
+int program_systimer_deadline(unsigned long long deadline)
 {
 	unsigned int cntp_ctl;
-	unsigned long long count_val;
-	unsigned int freq;
 
 	/* Check timer base is initialised */
 	assert(g_systimer_base);
 
-	count_val = mmio_read_64(g_systimer_base + CNTPCT_LO);
-	freq = read_cntfrq_el0();
-	count_val += (freq * time_out_ms) / 1000;
-	mmio_write_64(g_systimer_base + CNTP_CVAL_LO, count_val);
+	mmio_write_64(g_systimer_base + CNTP_CVAL_LO, deadline);
 
 	/* Enable the timer */
 	cntp_ctl = mmio_read_32(g_systimer_base + CNTP_CTL_LO);
@@ -36,6 +31,25 @@ int program_systimer(unsigned long time_out_ms)
 	clr_cntp_ctl_imask(cntp_ctl);
 	mmio_write_32(g_systimer_base + CNTP_CTL_LO, cntp_ctl);
 
+	VERBOSE("%s : interrupt requested at sys_counter: %llu\n", __func__,
+		deadline);
+
+	return 0;
+}
+
+int program_systimer(unsigned long time_out_ms)
+{
+	unsigned long long count_val;
+	unsigned int freq;
+
+	/* Check timer base is initialised */
+	assert(g_systimer_base);
+
+	count_val = mmio_read_64(g_systimer_base + CNTPCT_LO);
+	freq = read_cntfrq_el0();
+	count_val += (freq * time_out_ms) / 1000;
+	program_systimer_deadline(count_val);
+
 	/*
 	 * Ensure that we have programmed a timer interrupt for a time in
 	 * future. Else we will have to wait for the systimer to rollover
@@ -44,9 +58,6 @@ int program_systimer(unsigned long time_out_ms)
 	if (count_val < mmio_read_64(g_systimer_base + CNTPCT_LO))
 		panic();
 
-	VERBOSE("%s : interrupt requested at sys_counter: %llu "
-		"time_out_ms: %ld\n", __func__, count_val, time_out_ms);
-
 	return 0;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,7 +8,11 @@
 
 int console_putc(int c)
 {
+#if defined(IMAGE_TFTF) && PL011_TX_IRQ
+	return console_pl011_irq_putc(c);
+#else
 	return console_pl011_putc(c);
+#endif
 }
 
 #ifdef SMC_FUZZ_VARIABLE_COVERAGE
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -17,6 +17,20 @@
 /* Prototype of a handler function for an IRQ */
 typedef int (*irq_handler_t)(void *data);
 
+/* Statistics of the handler of an IRQ, see tftf_irq_get_stats() */
+typedef struct {
+	/* Number of times the handler has been called */
+	uint64_t count;
+	/* Longest time spent in the handler, in system counter ticks */
+	uint64_t max_ticks;
+} irq_stats_t;
+
+/* Keep track of the handler registered for an IRQ and of its statistics */
+typedef struct {
+	irq_handler_t handler;
+	irq_stats_t stats;
+} irq_desc_t;
+
 /* return the GIC version detected */
 int arm_gic_get_version(void);
 
@@ -47,6 +61,17 @@ void arm_gic_enable_interrupts_local(void);
  *****************************************************************************/
 void arm_gic_send_sgi(unsigned int sgi_id, unsigned int core_pos);
 
+/******************************************************************************
+ * Send SGI with ID `sgi_id` to the cores whose entry in `targets`, an array of
+ * PLATFORM_CORE_COUNT entries indexed by core position, is true.
+ *****************************************************************************/
+void arm_gic_send_sgi_multicast(unsigned int sgi_id, const bool *targets);
+
+/******************************************************************************
+ * Send SGI with ID `sgi_id` to all the cores but the calling one.
+ *****************************************************************************/
+void arm_gic_send_sgi_others(unsigned int sgi_id);
+
 /******************************************************************************
  * Get the INTID for an SGI with number `seq_id` for a core with index
  * `core_pos`.
@@ -160,9 +185,10 @@ void arm_gic_restore_context_global(void);
 bool arm_gic_is_espi_supported(void);
 
 /******************************************************************************
- * Gets the handler for an interrupt
+ * Gets the descriptor of an interrupt, holding its handler. For banked
+ * interrupts, this is the descriptor of the calling core.
  *****************************************************************************/
-irq_handler_t *arm_gic_get_irq_handler(unsigned int irq_num);
+irq_desc_t *arm_gic_get_irq_desc(unsigned int irq_num);
 
 /******************************************************************************
  * Returns true if the IRQ number is shared between cores (as opposed to
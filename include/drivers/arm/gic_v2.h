@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -28,6 +28,11 @@
 /* GICD_SGIR bit shifts */
 #define GICD_SGIR_INTID_SHIFT		0
 #define GICD_SGIR_CPUTL_SHIFT		16
+#define GICD_SGIR_TLF_SHIFT		24
+
+/* GICD_SGIR target list filter values */
+#define GICD_SGIR_TLF_LIST		0
+#define GICD_SGIR_TLF_OTHERS		1
 
 /* Physical CPU Interface register offsets */
 #define GICC_CTLR		0x0
@@ -96,6 +101,7 @@
 #ifndef __ASSEMBLY__
 
 #include <mmio.h>
+#include <stdbool.h>
 
 /*******************************************************************************
  * Private Interfaces for internal use by the GICv2 driver
@@ -276,6 +282,17 @@ void gicv2_set_itargetsr_value(unsigned int num, unsigned int val);
  */
 void gicv2_send_sgi(unsigned int sgi_id, unsigned int core_pos);
 
+/*
+ * Send SGI with ID `sgi_id` to the cores whose entry in `targets`, indexed by
+ * core position, is true.
+ */
+void gicv2_send_sgi_multicast(unsigned int sgi_id, const bool *targets);
+
+/*
+ * Send SGI with ID `sgi_id` to all the cores but the calling one.
+ */
+void gicv2_send_sgi_others(unsigned int sgi_id);
+
 /*
  * Get the priority of the interrupt `interrupt_id`.
  */
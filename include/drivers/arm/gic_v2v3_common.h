@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -20,6 +20,13 @@
 #define MAX_PPI_ID		31
 #define MIN_SPI_ID		32
 #define MAX_SPI_ID		1019
+/*
+ * LPIs start at 8192. Handlers can only be registered for the first
+ * MAX_LPI_ID - MIN_LPI_ID + 1 of them, which are the ones the ITS driver
+ * hands out.
+ */
+#define MIN_LPI_ID		8192
+#define MAX_LPI_ID		(MIN_LPI_ID + 63)
 
 #define IS_SGI(irq_num)							\
 	(((irq_num) >= MIN_SGI_ID) && ((irq_num) <= MAX_SGI_ID))
@@ -34,6 +41,9 @@
 	(((irq_num) >= MIN_SPI_ID) &&					\
 	 ((irq_num) <= MIN_SPI_ID + PLAT_MAX_SPI_OFFSET_ID))
 
+#define IS_LPI(irq_num)							\
+	(((irq_num) >= MIN_LPI_ID) && ((irq_num) <= MAX_LPI_ID))
+
 #define IS_VALID_INTR_ID(irq_num)					\
 	(((irq_num) >= MIN_SGI_ID) && ((irq_num) <= MAX_SPI_ID))
 
@@ -120,7 +130,7 @@ void gicd_set_ipriorityr(uintptr_t base, unsigned int interrupt_id,
 					unsigned int priority);
 bool gicv2v3_is_irq_spi(unsigned int irq_num);
 void gicv2v3_irq_setup(void);
-irq_handler_t *gicv2v3_get_irq_handler(unsigned int irq_num);
+irq_desc_t *gicv2v3_get_irq_desc(unsigned int irq_num);
 
 static inline unsigned int gicv2v3_get_sgi_num(unsigned int irq_num,
 						unsigned int core_pos)
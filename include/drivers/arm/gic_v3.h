@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -40,6 +40,9 @@
 #define	TYPER_ESPI_RANGE_MASK	U(0x1f)
 #define	TYPER_ESPI_RANGE_SHIFT	U(27)
 #define	TYPER_ESPI_RANGE	U(TYPER_ESPI_MASK << TYPER_ESPI_SHIFT)
+#define	TYPER_LPIS		U(1 << 17)
+#define	TYPER_IDBITS_SHIFT	U(19)
+#define	TYPER_IDBITS_MASK	U(0x1f)
 
 /*******************************************************************************
  * GICv3 Re-distributor interface registers & constants
@@ -49,6 +52,8 @@
 #define GICR_CTLR		0x0
 #define GICR_TYPER		0x08
 #define GICR_WAKER		0x14
+#define GICR_PROPBASER		0x70
+#define GICR_PENDBASER		0x78
 #define GICR_IGROUPR0		(GICR_SGIBASE_OFFSET + 0x80)
 #define GICR_ISENABLER0		(GICR_SGIBASE_OFFSET + 0x100)
 #define GICR_ICENABLER0		(GICR_SGIBASE_OFFSET + 0x180)
@@ -59,6 +64,19 @@
 #define GICR_ICFGR1		(GICR_SGIBASE_OFFSET + 0xc04)
 #define GICR_IGRPMODR0		(GICR_SGIBASE_OFFSET + 0xd00)
 
+/* GICR_CTLR bit definitions */
+#define GICR_CTLR_ENABLE_LPIS		(1 << 0)
+
+/* GICR_TYPER bit definitions, see also TYPER_* above */
+#define GICR_TYPER_PLPIS		(1ULL << 0)
+
+/* GICR_PROPBASER and GICR_PENDBASER bit definitions */
+#define GICR_PROPBASER_IDBITS_MASK	0x1fULL
+#define GICR_BASER_INNER_CACHE_SHIFT	7
+#define GICR_BASER_SHAREABILITY_SHIFT	10
+#define GICR_BASER_SHAREABILITY_MASK	0x3ULL
+#define GICR_PENDBASER_PTZ		(1ULL << 62)
+
 /*******************************************************************************
  * GICv3 CPU interface registers & constants
  ******************************************************************************/
@@ -84,7 +102,7 @@
 #define SGI1R_INTID_MASK		0xf
 #define SGI1R_INTID_SHIFT		24
 #define SGI1R_IRM_MASK			0x1
-#define SGI1R_IRM_SHIFT			0x40
+#define SGI1R_IRM_SHIFT			40ULL
 
 /* ICC_IGRPEN1_EL1 bit definitions */
 #define IGRPEN1_EL1_ENABLE_SHIFT	0
@@ -199,6 +217,8 @@
 
 #ifndef ASSEMBLY
 
+#include <stdbool.h>
+
 /*******************************************************************************
  * Helper GICv3 macros
  ******************************************************************************/
@@ -233,6 +253,12 @@ void gicv3_setup_distif(void);
  */
 void gicv3_probe_redistif_addr(void);
 
+/*
+ * Return the base address of the Re-distributor of the core with index
+ * `core_pos`, or 0 if that core has not probed it yet.
+ */
+uintptr_t gicv3_get_redistif_base(unsigned int core_pos);
+
 /*
  * Set the bit corresponding to `interrupt_id` in the ICPENDR register
  * at either Distributor or Re-distributor depending on the interrupt.
@@ -274,6 +300,18 @@ void gicv3_set_intr_route(unsigned int interrupt_id, unsigned int core_pos);
  */
 void gicv3_send_sgi(unsigned int sgi_id, unsigned int core_pos);
 
+/*
+ * Send SGI with ID `sgi_id` to the cores whose entry in `targets`, indexed by
+ * core position, is true. Cores sharing their Aff3.Aff2.Aff1 affinity are
+ * signalled with a single write to ICC_SGI1R.
+ */
+void gicv3_send_sgi_multicast(unsigned int sgi_id, const bool *targets);
+
+/*
+ * Send SGI with ID `sgi_id` to all the cores but the calling one.
+ */
+void gicv3_send_sgi_others(unsigned int sgi_id);
+
 /*
  * Get the priority of the interrupt `interrupt_id`.
  */
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __GIC_V3_ITS_H__
+#define __GIC_V3_ITS_H__
+
+/***************************************************************************
+ * Defines and prototypes specific to the GICv3 Interrupt Translation
+ * Service (ITS).
+ *************************************************************************/
+
+/* ITS control registers, in the first 64KB frame */
+#define GITS_CTLR		0x0
+#define GITS_IIDR		0x4
+#define GITS_TYPER		0x8
+#define GITS_CBASER		0x80
+#define GITS_CWRITER		0x88
+#define GITS_CREADR		0x90
+#define GITS_BASER(n)		(0x100 + ((n) << 3))
+#define GITS_BASER_NUM		8U
+
+/* ITS translation register, in the second 64KB frame */
+#define GITS_TRANSLATER		0x10040
+
+/* GITS_CTLR bit definitions */
+#define GITS_CTLR_ENABLED		(1U << 0)
+#define GITS_CTLR_QUIESCENT		(1U << 31)
+
+/* GITS_TYPER bit definitions */
+#define GITS_TYPER_PHYSICAL		(1ULL << 0)
+#define GITS_TYPER_ITT_ENTRY_SIZE_SHIFT	4
+#define GITS_TYPER_ITT_ENTRY_SIZE_MASK	0xfULL
+#define GITS_TYPER_IDBITS_SHIFT		8
+#define GITS_TYPER_IDBITS_MASK		0x1fULL
+#define GITS_TYPER_DEVBITS_SHIFT	13
+#define GITS_TYPER_DEVBITS_MASK		0x1fULL
+#define GITS_TYPER_PTA			(1ULL << 19)
+
+/* GITS_CBASER and GITS_BASER<n> bit definitions */
+#define GITS_BASER_VALID		(1ULL << 63)
+#define GITS_BASER_INDIRECT		(1ULL << 62)
+#define GITS_BASER_INNER_CACHE_SHIFT	59
+#define GITS_BASER_TYPE_SHIFT		56
+#define GITS_BASER_TYPE_MASK		0x7ULL
+#define GITS_BASER_TYPE_DEVICE		1ULL
+#define GITS_BASER_TYPE_COLLECTION	4ULL
+#define GITS_BASER_ENTRY_SIZE_SHIFT	48
+#define GITS_BASER_ENTRY_SIZE_MASK	0x1fULL
+#define GITS_BASER_SHAREABILITY_SHIFT	10
+#define GITS_BASER_SHAREABILITY_MASK	0x3ULL
+#define GITS_BASER_PAGE_SIZE_SHIFT	8
+#define GITS_BASER_PAGE_SIZE_MASK	0x3ULL
+#define GITS_BASER_SIZE_MASK		0xffULL
+
+/* Memory attributes used for all the GIC tables */
+#define GIC_BASER_CACHE_RAWAWB		0x7ULL
+#define GIC_BASER_INNER_SHAREABLE	0x1ULL
+
+/* GITS_CWRITER and GITS_CREADR bit definitions */
+#define GITS_CREADR_STALLED		(1ULL << 0)
+#define GITS_CMD_OFFSET_MASK		0xfffe0ULL
+
+/* ITS command opcodes */
+#define GITS_CMD_MOVI			0x01ULL
+#define GITS_CMD_INT			0x03ULL
+#define GITS_CMD_SYNC			0x05ULL
+#define GITS_CMD_MAPD			0x08ULL
+#define GITS_CMD_MAPC			0x09ULL
+#define GITS_CMD_MAPTI			0x0aULL
+#define GITS_CMD_INV			0x0cULL
+#define GITS_CMD_DISCARD		0x0fULL
+
+/* LPI configuration table entry */
+#define LPI_PROP_ENABLE			(1U << 0)
+#define LPI_PROP_RES1			(1U << 1)
+#define LPI_PROP_PRIORITY_MASK		0xfcU
+
+/* Maximum number of devices that can be mapped at the same time */
+#define GICV3_ITS_MAX_DEVICES		4U
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+/******************************************************************************
+ * GICv3 ITS public driver API
+ *
+ * The ITS translates the writes of a device to GITS_TRANSLATER, identified by
+ * a DeviceID and the EventID written, into LPIs. LPIs are handled through the
+ * usual TFTF IRQ API (tftf_irq_register_handler() and friends), but they are
+ * enabled and routed with the functions below rather than tftf_irq_enable().
+ * Only LPIs in the range [MIN_LPI_ID, MAX_LPI_ID] can be used.
+ *
+ * Functions returning an int return 0 on success and a negative value on
+ * failure.
+ *****************************************************************************/
+
+/*
+ * Initialize the ITS at `its_base`: set up its command queue and its device
+ * and collection tables, and enable it. It fails if the GIC does not support
+ * LPIs. Calling it again once the ITS is enabled is harmless.
+ */
+int gicv3_its_init(uintptr_t its_base);
+
+/*
+ * Enable LPIs in the Re-distributor of the calling core, and map the
+ * collection of the core, whose ID is the core position. It must be called
+ * on each core LPIs are routed to, after gicv3_its_init() and after the core
+ * is powered on.
+ */
+int gicv3_its_setup_local(void);
+
+/*
+ * Map the device `device_id`, with `num_events` EventIDs starting at 0.
+ * Mapping a device which is already mapped is harmless if it has enough
+ * events.
+ */
+int gicv3_its_map_device(uint32_t device_id, unsigned int num_events);
+
+/*
+ * Unmap the device `device_id`, discarding the translation of all its events
+ * that have been mapped to LPIs.
+ */
+void gicv3_its_unmap_device(uint32_t device_id);
+
+/*
+ * Translate event `event_id` of device `device_id` into LPI `lpi`, and route
+ * it to the core with index `core_pos`. The LPI is left disabled.
+ */
+int gicv3_its_map_lpi(uint32_t device_id, uint32_t event_id, unsigned int lpi,
+		      unsigned int core_pos);
+
+/*
+ * Route LPI `lpi` to the core with index `core_pos`.
+ */
+void gicv3_its_route_lpi(unsigned int lpi, unsigned int core_pos);
+
+/*
+ * Enable LPI `lpi` with priority `priority`.
+ */
+void gicv3_its_lpi_enable(unsigned int lpi, unsigned int priority);
+
+/*
+ * Disable LPI `lpi`.
+ */
+void gicv3_its_lpi_disable(unsigned int lpi);
+
+/*
+ * Make LPI `lpi` pending with an INT command, as if its device had written
+ * its EventID to GITS_TRANSLATER. The function does not wait for the ITS to
+ * process the command.
+ */
+void gicv3_its_inject_lpi(unsigned int lpi);
+
+/*
+ * Return the address of GITS_TRANSLATER, which devices write EventIDs to.
+ */
+uintptr_t gicv3_its_get_translater(void);
+
+#endif /* __ASSEMBLER__ */
+#endif /* __GIC_V3_ITS_H__ */
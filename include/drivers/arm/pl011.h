@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -55,6 +55,16 @@
 #define PL011_UARTCR_LBE          (1 << 7)	/* Loopback enable */
 #define PL011_UARTCR_UARTEN       (1 << 0)	/* UART Enable */
 
+/* Interrupt FIFO level select reg bits */
+#define PL011_UARTIFLS_TXIFLSEL_MASK	(7 << 0)
+#define PL011_UARTIFLS_TX_1_8		(0 << 0)	/* TX FIFO <= 1/8 full */
+#define PL011_UARTIFLS_TX_1_4		(1 << 0)	/* TX FIFO <= 1/4 full */
+#define PL011_UARTIFLS_TX_1_2		(2 << 0)	/* TX FIFO <= 1/2 full */
+
+/* Interrupt mask set/clear and interrupt clear reg bits */
+#define PL011_UARTIMSC_TXIM       (1 << 5)	/* Transmit interrupt mask */
+#define PL011_UARTICR_TXIC        (1 << 5)	/* Transmit interrupt clear */
+
 #if !defined(PL011_LINE_CONTROL)
 /* FIFO Enabled / No Parity / 8 Data bit / One Stop Bit */
 #define PL011_LINE_CONTROL  (PL011_UARTLCR_H_FEN | PL011_UARTLCR_H_WLEN_8)
@@ -75,12 +85,36 @@
 /* Constants */
 #define PL011_BAUDRATE		115200
 
+/*
+ * State of the interrupt-driven transmit mode (struct pl011_tx_state). The
+ * crash path drains its ring buffer from assembly, so the offsets of the fields
+ * it uses are fixed. The size of the ring buffer must be a power of 2.
+ */
+#define PL011_TX_BUF_SIZE		4096
+#define PL011_TX_STATE_BASE		0
+#define PL011_TX_STATE_HEAD		8
+#define PL011_TX_STATE_TAIL		12
+#define PL011_TX_STATE_BUF		16
+
 #ifndef __ASSEMBLER__
 #include <stdint.h>
 
 /* Functions */
 
 int console_pl011_putc(int);
+int console_core_putc(int c, uintptr_t base_addr);
+int console_core_flush(uintptr_t base_addr);
+
+/*
+ * Interrupt-driven transmit mode, available when PL011_TX_IRQ=1. Characters
+ * are queued in a software ring buffer, which is drained into the transmit
+ * FIFO from the UART interrupt.
+ */
+int console_pl011_irq_init(uintptr_t base_addr, unsigned int irq_num);
+int console_pl011_irq_putc(int c);
+void console_pl011_irq_drain(void);
+/* Lock-free drain for the crash path, usable without a stack. */
+void console_pl011_irq_crash_drain(void);
 #ifdef SMC_FUZZ_VARIABLE_COVERAGE
 int console_pl011_putc_fuzzer(int);
 static int tftf_console_state;
@@ -17,5 +17,6 @@ int arm_gen_timer_init(void);
 int arm_gen_timer_handler(void);
 int arm_gen_timer_cancel(void);
 int arm_gen_timer_program(unsigned long time_out_ms);
+int arm_gen_timer_program_deadline(unsigned long long deadline);
 
 #endif /* __PRIVATE_TIMER_H__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,6 +15,13 @@
  * Always return 0
  */
 int program_systimer(unsigned long time_out_ms);
+/*
+ * Program systimer to fire an interrupt when the system counter reaches
+ * deadline. A deadline in the past fires immediately.
+ *
+ * Always return 0
+ */
+int program_systimer_deadline(unsigned long long deadline);
 /*
  * Cancel the currently programmed systimer interrupt
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,7 @@
 
 #include <cdefs.h>
 #include <platform_def.h> /* For CACHE_WRITEBACK_GRANULE */
+#include <stdbool.h>
 #include <stdint.h>
 #include <drivers/arm/arm_gic.h>
 
@@ -34,30 +35,25 @@
 
 #ifndef __ASSEMBLY__
 
-/* Keep track of the IRQ handler registered for a given SPI */
-typedef struct {
-	irq_handler_t handler;
-} spi_desc;
-
-/* Keep track of the IRQ handler registered for a spurious interrupt */
-typedef irq_handler_t spurious_desc;
+/*
+ * SPIs are shared by all CPUs, so is their descriptor. This is also the case
+ * of LPIs and of the spurious interrupt.
+ */
+typedef irq_desc_t spi_desc;
+typedef irq_desc_t spurious_desc;
 
 /*
  * PPIs and SGIs are interrupts that are private to a GIC CPU interface. These
  * interrupts are banked in the GIC Distributor. Therefore, each CPU can
  * set up a different IRQ handler for a given PPI/SGI.
  *
- * So we define a data structure representing an IRQ handler aligned on the
- * size of a cache line. This guarantees that in an array of these, each element
- * is loaded in a separate cache line. This allows efficient concurrent
- * manipulation of these elements on different CPUs.
+ * So the GIC drivers keep a table of these descriptors for each CPU, aligned on
+ * the size of a cache line. The dispatch of an interrupt on a CPU only touches
+ * the cache lines of its own table, and a CPU updating its handlers doesn't
+ * disturb the others.
  */
-typedef struct {
-	irq_handler_t handler;
-} __aligned(CACHE_WRITEBACK_GRANULE) irq_handler_banked_t;
-
-typedef irq_handler_banked_t ppi_desc;
-typedef irq_handler_banked_t sgi_desc;
+typedef irq_desc_t ppi_desc;
+typedef irq_desc_t sgi_desc;
 
 void tftf_irq_setup(void);
 
@@ -80,6 +76,18 @@ int tftf_irq_handler_dispatcher(void);
  */
 void tftf_send_sgi(unsigned int sgi_id, unsigned int core_pos);
 
+/*
+ * Send an SGI to the cores whose entry in `targets`, an array of
+ * PLATFORM_CORE_COUNT entries indexed by core position, is true. This takes
+ * fewer GIC accesses than calling tftf_send_sgi() for each of them.
+ */
+void tftf_send_sgi_multicast(unsigned int sgi_id, const bool *targets);
+
+/*
+ * Send an SGI to all the online cores but the calling one.
+ */
+void tftf_send_sgi_others(unsigned int sgi_id);
+
 /*
  * Enable interrupt #irq_num for the calling core.
  */
@@ -111,6 +119,16 @@ int tftf_irq_register_handler_sgi(unsigned int sgi_id, irq_handler_t irq_handler
 int tftf_irq_unregister_handler(unsigned int irq_num);
 int tftf_irq_unregister_handler_sgi(unsigned int sgi_id);
 
+/*
+ * Get the statistics of the handler registered for a given interrupt number,
+ * since it was registered. For SGIs and PPIs, these are the statistics of the
+ * calling core's handler. None are kept for the spurious interrupt.
+ *
+ * Return 0 on success, a negative value if no handler is registered.
+ */
+int tftf_irq_get_stats(unsigned int irq_num, irq_stats_t *stats);
+int tftf_irq_get_stats_sgi(unsigned int sgi_id, irq_stats_t *stats);
+
 #endif /* __ASSEMBLY__ */
 
 #endif /* __IRQ_H__ */
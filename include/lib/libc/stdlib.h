@@ -27,4 +27,7 @@ extern void exit(int status);
 int rand(void);
 void srand(unsigned int seed);
 
+void qsort(void *base, size_t nmemb, size_t size,
+	   int (*compar)(const void *, const void *));
+
 #endif /* STDLIB_H */
@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 /*
- * Portions copyright (c) 2018-2019, ARM Limited and Contributors.
+ * Portions copyright (c) 2018-2026, ARM Limited and Contributors.
  * All rights reserved.
  */
 
@@ -27,4 +27,28 @@ char *strrchr(const char *p, int ch);
 size_t strlcpy(char * dst, const char * src, size_t dsize);
 char *strncpy(char *dst, const char *src, size_t n);
 
+/*
+ * Implementations of the memory functions that only use general purpose
+ * loads and stores, and work on any PE.
+ */
+void *memcpy_generic(void *dst, const void *src, size_t len);
+void *memset_generic(void *dst, int val, size_t count);
+
+#ifdef __aarch64__
+/*
+ * Implementations that use the FEAT_MOPS instructions. They must only be
+ * called when FEAT_MOPS is implemented and not trapped.
+ */
+void *memcpy_mops(void *dst, const void *src, size_t len);
+void *memset_mops(void *dst, int val, size_t count);
+
+/*
+ * Select the implementation of memcpy() and memset() that best suits the PE.
+ * The FEAT_MOPS instructions are used when they are implemented, so this must
+ * only be called once the MMU is enabled and from an Exception level at which
+ * they are not trapped. Until then, the generic implementations are used.
+ */
+void memfuncs_init(void);
+#endif
+
 #endif /* STRING_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,4 +15,7 @@ void init_spinlock(spinlock_t *lock);
 void spin_lock(spinlock_t *lock);
 void spin_unlock(spinlock_t *lock);
 
+/* Takes the lock if it is free. Returns 1 if it was taken, 0 otherwise. */
+int spin_trylock(spinlock_t *lock);
+
 #endif /* __SPINLOCK_H__ */
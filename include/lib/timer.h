@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,10 @@
 #define __TIMER_H__
 
 #include <irq.h>
+#include <stdbool.h>
+
+/* Maximum number of outstanding timer requests on each core. */
+#define TIMER_REQS_PER_CORE	4
 
 typedef struct plat_timer {
 	int (*program)(unsigned long time_out_ms);
@@ -15,13 +19,32 @@ typedef struct plat_timer {
 	int (*handler)(void);
 
 	/*
-	 * Duration of the atomic time slice in milliseconds. All timer
-	 * requests within the same time slice are merged into one. This value
-	 * should be chosen such that it is greater than the time required to
-	 * program the timer.
+	 * Optional. Program the timer to fire when the system counter reaches
+	 * 'deadline', firing immediately if it is in the past. When it is not
+	 * provided, the timer framework programs timeouts with program(),
+	 * rounded up to the next millisecond.
+	 */
+	int (*program_deadline)(unsigned long long deadline);
+
+	/*
+	 * Minimum timeout in milliseconds of tftf_program_timer() requests.
+	 * This value should be chosen such that it is greater than the time
+	 * required to program the timer.
 	 */
 	unsigned int timer_step_value;
 	unsigned int timer_irq;
+
+	/*
+	 * Set if each CPU has its own instance of the timer, e.g. the
+	 * architected timer, and timer_irq is a PPI. Requests are then
+	 * programmed on the calling CPU without being serialised with the
+	 * other CPUs. Otherwise, a single timer is shared by all CPUs and its
+	 * interrupt is forwarded to the requesting CPUs with IRQ_WAKE_SGI.
+	 *
+	 * A per-CPU timer loses its state when the CPU is powered down, so it
+	 * can't be used to wake up from power down states.
+	 */
+	bool per_cpu;
 } plat_timer_t;
 
 /*
@@ -43,6 +66,42 @@ void tftf_initialise_timer_secondary_core(void);
  */
 int tftf_program_timer(unsigned long milli_secs);
 
+/*
+ * Same as tftf_program_timer() with a timeout in microseconds. The timeout
+ * isn't rounded up to the timer step value.
+ * Returns 0 on success and -1 on failure.
+ */
+int tftf_program_timer_us(unsigned long micro_secs);
+
+/*
+ * Same as tftf_program_timer_us(), also returning in 'deadline' the system
+ * counter value the request is due at, as computed by the timer framework.
+ * On platforms without microsecond resolution, the interrupt may come up to
+ * a millisecond after it.
+ * Returns 0 on success and -1 on failure.
+ */
+int tftf_program_timer_us_deadline(unsigned long micro_secs,
+				   unsigned long long *deadline);
+
+/*
+ * Requests the timer framework to send an interrupt after micro_secs, in
+ * addition to the request made with tftf_program_timer(). Up to
+ * TIMER_REQS_PER_CORE - 1 such requests can be outstanding on each core. The
+ * interrupt is handled by the handler registered with
+ * tftf_timer_register_handler(), like the one of tftf_program_timer().
+ *
+ * Returns a positive request identifier to pass to tftf_cancel_timer_req(),
+ * or -1 on failure.
+ */
+int tftf_timer_req_us(unsigned long micro_secs);
+
+/*
+ * Cancels a request made by the calling core with tftf_timer_req_us(). It
+ * has no effect if the interrupt for this request has already been sent.
+ * Returns 0 on success, negative value otherwise.
+ */
+int tftf_cancel_timer_req(int req_id);
+
 /*
  * Requests the timer framework to send an interrupt after milli_secs and to
  * suspend the CPU to the desired power state. The interrupt is sent to the
@@ -61,6 +120,13 @@ int tftf_program_timer_and_suspend(unsigned long milli_secs,
 				   unsigned int pwr_state,
 				   int *timer_rc, int *suspend_rc);
 
+/*
+ * Same as tftf_program_timer_and_suspend() with a timeout in microseconds.
+ */
+int tftf_program_timer_us_and_suspend(unsigned long micro_secs,
+				      unsigned int pwr_state,
+				      int *timer_rc, int *suspend_rc);
+
 /*
  * Requests the timer framework to send an interrupt after milli_secs and to
  * suspend the system. The interrupt is sent to the calling core of this api.
@@ -87,8 +153,8 @@ int tftf_timer_sleep(unsigned long milli_secs);
 
 /*
  * Common handler for servicing all the timer interrupts. It in turn calls the
- * peripheral specific handler. It also sends WAKE_SGI to all the cores which
- * requested an interrupt within a time frame of timer_step_value.
+ * peripheral specific handler. It also sends WAKE_SGI to all the cores whose
+ * requested interrupt time has been reached.
  * Also, if there are pending interrupt requests, reprograms the timer
  * accordingly to fire an interrupt at the right time.
  *
@@ -127,6 +193,18 @@ unsigned int tftf_get_timer_irq(void);
  */
 unsigned int tftf_get_timer_step_value(void);
 
+/*
+ * Returns true if each CPU has its own instance of the platform timer, see
+ * plat_timer_t.per_cpu.
+ */
+bool tftf_timer_is_per_cpu(void);
+
+/*
+ * Returns true if the platform timer can be programmed with a deadline, in
+ * which case timeouts in microseconds aren't rounded up to the millisecond.
+ */
+bool tftf_timer_has_us_resolution(void);
+
 /*
  * Restore the GIC state after wake-up from system suspend
  */
@@ -113,6 +113,17 @@
 #define XLAT_TABLE_IDX(virtual_addr, level)	\
 	(((virtual_addr) >> XLAT_ADDR_SHIFT(level)) & ULL(0x1FF))
 
+/*
+ * Number of adjacent block or page descriptors that can be grouped together
+ * with the Contiguous hint, and size of the memory mapped by such a group of
+ * descriptors at a given lookup level. This macro assumes the system is using
+ * the 4KB translation granule.
+ */
+#define XLAT_CONT_ENTRIES_SHIFT	U(4)
+#define XLAT_CONT_ENTRIES	(U(1) << XLAT_CONT_ENTRIES_SHIFT)
+#define XLAT_CONT_SIZE(level)	(XLAT_BLOCK_SIZE(level) << XLAT_CONT_ENTRIES_SHIFT)
+#define XLAT_CONT_MASK(level)	(XLAT_CONT_SIZE(level) - UL(1))
+
 /*
  * The ARMv8 translation table descriptor format defines AP[2:1] as the Access
  * Permissions bits, and does not define an AP[0] bit.
@@ -339,6 +339,13 @@ int mmap_remove_dynamic_region_ctx(xlat_ctx_t *ctx,
  * NOTE2: The caller is responsible for making sure that the targeted
  * translation tables are not modified by any other code while this function is
  * executing.
+ *
+ * NOTE3: If a page of the memory region is part of a group of descriptors with
+ * the Contiguous hint set, the hint is cleared on the whole group first, which
+ * needs a break-before-make sequence. The other pages of the group, i.e. the
+ * rest of the XLAT_CONT_SIZE(3U) aligned range around the page, are briefly
+ * unmapped while this happens, so the caller must make sure that they are not
+ * accessed by any PE in the meantime.
  */
 int xlat_change_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 				   size_t size, uint32_t attr);
@@ -363,5 +370,24 @@ int xlat_get_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 				uint32_t *attr);
 int xlat_get_mem_attributes(uintptr_t base_va, uint32_t *attr);
 
+/*
+ * Query the raw block or page descriptor that maps a memory page in a set of
+ * translation tables. This is mostly useful to check descriptor bits that are
+ * not reported as attributes, like the Contiguous hint.
+ *
+ * Return 0 on success, a negative error code on error.
+ * On success, the descriptor is stored into *desc.
+ *
+ * ctx
+ *   Translation context to work on.
+ * base_va
+ *   Virtual address of the page to get the descriptor of. There are no
+ *   alignment restrictions on this address.
+ * desc
+ *   Output parameter where to store the descriptor.
+ */
+int xlat_get_desc_ctx(const xlat_ctx_t *ctx, uintptr_t base_va, uint64_t *desc);
+int xlat_get_desc(uintptr_t base_va, uint64_t *desc);
+
 #endif /*__ASSEMBLY__*/
 #endif /* XLAT_TABLES_V2_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -30,8 +30,8 @@ struct cactus_cmd_handler {
 
 /**
  * Helper to define Cactus command handler, and pair it with a command ID.
- * It also creates a table with this information, to be traversed by
- * 'cactus_handle_cmd' function.
+ * It also creates a table with this information, which is indexed by
+ * 'cactus_cmd_table_init' for the 'cactus_handle_cmd' function.
  */
 #define CACTUS_CMD_HANDLER(name, ID)					\
 	CACTUS_HANDLER_FN(name);					\
@@ -40,6 +40,12 @@ struct cactus_cmd_handler {
 	};								\
 	CACTUS_HANDLER_FN(name)
 
+/**
+ * Build the hash table used to look up command handlers. Must be called once,
+ * by the primary vCPU, before any command is handled.
+ */
+void cactus_cmd_table_init(void);
+
 bool cactus_handle_cmd(struct ffa_value *cmd_args, struct ffa_value *ret,
 		       struct mailbox_buffers *mb);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -48,6 +48,15 @@ static inline struct ffa_value cactus_send_cmd(
 					  val3);
 }
 
+#ifdef IMAGE_CACTUS
+/**
+ * Record the time at which the response to the command being handled is sent,
+ * for the statistics of its handler and CACTUS_GET_CMD_TIMING_CMD. Defined in
+ * cactus_message_loop.c.
+ */
+void cactus_cmd_mark_response(void);
+#endif
+
 /**
  * Template for responses to Cactus commands.
  * 'cactus_send_response' is the template for custom responses, in case there is
@@ -57,6 +66,9 @@ static inline struct ffa_value cactus_send_response(
 	ffa_id_t source, ffa_id_t dest, uint32_t resp, uint64_t val0,
 	uint64_t val1, uint64_t val2, uint64_t val3)
 {
+#ifdef IMAGE_CACTUS
+	cactus_cmd_mark_response();
+#endif
 	return ffa_msg_send_direct_resp64(source, dest, resp, val0, val1,
 					  val2, val3);
 }
@@ -120,6 +132,17 @@ static inline struct ffa_value cactus_echo_send_cmd(
 			       0);
 }
 
+/**
+ * Same as 'cactus_echo_send_cmd' with the SMC32 convention. Cactus answers
+ * with the SMC32 convention as well.
+ */
+static inline struct ffa_value cactus_echo32_send_cmd(
+	ffa_id_t source, ffa_id_t dest, uint32_t echo_val)
+{
+	return ffa_msg_send_direct_req32(source, dest, CACTUS_ECHO_CMD,
+					 echo_val, 0, 0, 0);
+}
+
 static inline uint64_t cactus_echo_get_val(struct ffa_value ret)
 {
 	return (uint64_t)ret.arg4;
@@ -239,6 +262,42 @@ static inline bool cactus_mem_send_is_normal_memory(struct ffa_value ret)
 	return (bool)((ret.arg7 >> 33) & 0x1);
 }
 
+/**
+ * Request an SP to retrieve and relinquish the memory region 'handle', sent
+ * with 'mem_func', without accessing it. The SP returns the time spent
+ * retrieving the region, including the FFA_MEM_FRAG_RX calls, and
+ * relinquishing it, in system counter ticks, and the number of fragments of
+ * the retrieve response.
+ *
+ * The command id is the hex representation of the string "memperf".
+ */
+#define CACTUS_MEM_PERF_CMD U(0x6d656d70657266)
+
+static inline struct ffa_value cactus_mem_perf_send_cmd(
+	ffa_id_t source, ffa_id_t dest, uint32_t mem_func,
+	ffa_memory_handle_t handle)
+{
+	return cactus_send_cmd(source, dest, CACTUS_MEM_PERF_CMD, mem_func,
+			       handle, 0, 0);
+}
+
+static inline uint64_t cactus_mem_perf_get_retrieve_ticks(
+	struct ffa_value ret)
+{
+	return (uint64_t)ret.arg4;
+}
+
+static inline uint64_t cactus_mem_perf_get_relinquish_ticks(
+	struct ffa_value ret)
+{
+	return (uint64_t)ret.arg5;
+}
+
+static inline uint32_t cactus_mem_perf_get_fragments(struct ffa_value ret)
+{
+	return (uint32_t)ret.arg6;
+}
+
 /**
  * Command to request a memory management operation. The 'mem_func' argument
  * identifies the operation that is to be performend, and 'receiver' is the id
@@ -348,6 +407,36 @@ static inline bool cactus_get_fwd_sleep_interrupted_hint(struct ffa_value ret)
 	return (bool)ret.arg6;
 }
 
+/**
+ * Command to request cactus to busy loop for the given time in ms, yielding
+ * its CPU cycles back to the caller with FFA_YIELD every 'yield_period_us'.
+ * The caller resumes it with FFA_RUN.
+ *
+ * The sender of this command expects to receive CACTUS_SUCCESS with the
+ * number of times the SP yielded.
+ *
+ * The command id is the hex representation of the string "yieldlp".
+ */
+#define CACTUS_YIELD_LOOP_CMD U(0x7969656c646c70)
+
+static inline struct ffa_value cactus_yield_loop_cmd(
+	ffa_id_t source, ffa_id_t dest, uint32_t run_time,
+	uint32_t yield_period_us)
+{
+	return cactus_send_cmd(source, dest, CACTUS_YIELD_LOOP_CMD, run_time,
+			       yield_period_us, 0, 0);
+}
+
+static inline uint32_t cactus_get_yield_period(struct ffa_value ret)
+{
+	return (uint32_t)ret.arg5;
+}
+
+static inline uint32_t cactus_get_yield_count(struct ffa_value ret)
+{
+	return (uint32_t)ret.arg4;
+}
+
 /**
  * Command to request cactus to sleep for half the given time in ms, trigger
  * trusted watchdog timer and then sleep again for another half the given time.
@@ -592,6 +681,84 @@ static inline uint32_t cactus_get_req_count(struct ffa_value ret)
 	return (uint32_t)ret.arg4;
 }
 
+/**
+ * Request SP to return the statistics of the handler of a command, for the
+ * vCPU the request is sent to: the number of requests handled, and the total
+ * and the longest time spent handling one up to its response, in system
+ * counter ticks.
+ *
+ * The command id is the hex representation of the string "cmdstats".
+ */
+#define CACTUS_GET_CMD_STATS_CMD U(0x636d647374617473)
+
+static inline struct ffa_value cactus_get_cmd_stats_send_cmd(
+	ffa_id_t source, ffa_id_t dest, uint64_t cmd_id)
+{
+	return cactus_send_cmd(source, dest, CACTUS_GET_CMD_STATS_CMD, cmd_id,
+			       0, 0, 0);
+}
+
+static inline uint64_t cactus_get_cmd_stats_cmd_id(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg4;
+}
+
+static inline uint32_t cactus_get_cmd_stats_count(struct ffa_value ret)
+{
+	return (uint32_t)ret.arg4;
+}
+
+static inline uint64_t cactus_get_cmd_stats_total_ticks(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg5;
+}
+
+static inline uint64_t cactus_get_cmd_stats_max_ticks(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg6;
+}
+
+/**
+ * Request SP to return when it handled the last command on the vCPU the
+ * request is sent to, as virtual counter values: when the request entered the
+ * command dispatcher, when the handler of the command was called and when the
+ * response was sent. Along with the time of the request and of the response in
+ * the sender, they split the round trip of a command in its legs.
+ *
+ * This command, CACTUS_GET_REQ_COUNT_CMD and CACTUS_GET_CMD_STATS_CMD are not
+ * recorded, so that they don't overwrite what they report.
+ *
+ * The command id is the hex representation of the string "cmdtime".
+ */
+#define CACTUS_GET_CMD_TIMING_CMD U(0x636d6474696d65)
+
+static inline struct ffa_value cactus_get_cmd_timing_send_cmd(
+	ffa_id_t source, ffa_id_t dest)
+{
+	return cactus_send_cmd(source, dest, CACTUS_GET_CMD_TIMING_CMD, 0, 0,
+			       0, 0);
+}
+
+static inline uint64_t cactus_get_cmd_timing_cmd_id(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg4;
+}
+
+static inline uint64_t cactus_get_cmd_timing_entry(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg5;
+}
+
+static inline uint64_t cactus_get_cmd_timing_handler(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg6;
+}
+
+static inline uint64_t cactus_get_cmd_timing_response(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg7;
+}
+
 /**
  * Request SP to return the last serviced secure virtual interrupt.
  *
@@ -606,6 +773,35 @@ static inline struct ffa_value cactus_get_last_interrupt_cmd(
 				 0, 0, 0, 0);
 }
 
+/**
+ * Request SP to return the last serviced secure virtual interrupt, along with
+ * the system counter values at which it was raised and at which the SP started
+ * handling it. The raised time is only known for the arch timer interrupt,
+ * for which it is the programmed deadline, and is 0 otherwise.
+ *
+ * The interrupt ID is retrieved with cactus_get_interrupt_id().
+ *
+ * The command id is the hex representation of the string "vLAT"
+ */
+#define CACTUS_LAST_INTERRUPT_LATENCY_CMD U(0x764c4154)
+
+static inline struct ffa_value cactus_get_last_interrupt_latency_cmd(
+	ffa_id_t source, ffa_id_t dest)
+{
+	return cactus_send_cmd(source, dest, CACTUS_LAST_INTERRUPT_LATENCY_CMD,
+			       0, 0, 0, 0);
+}
+
+static inline uint64_t cactus_get_interrupt_raised_cnt(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg5;
+}
+
+static inline uint64_t cactus_get_interrupt_handled_cnt(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg6;
+}
+
 /**
  * Request SP to resume the task requested by current endpoint after managed
  * exit.
@@ -686,6 +882,42 @@ static inline ffa_id_t cactus_msg_send_sender(struct ffa_value ret)
 	return (ffa_id_t)ret.arg6;
 }
 
+/**
+ * Request SP to consume the indirect message in its RX buffer, reading its
+ * payload in place or from a copy of it, and release the RX buffer. The SP
+ * returns the sum of the payload bytes, the payload size and the sender.
+ *
+ * Command ID is string: MSGRECV.
+ */
+#define CACTUS_IND_MSG_RECV_CMD U(0x4d534752454356)
+
+static inline struct ffa_value cactus_ind_msg_recv_cmd(
+	ffa_id_t source, ffa_id_t dest, bool in_place)
+{
+	return cactus_send_cmd(source, dest, CACTUS_IND_MSG_RECV_CMD,
+			       in_place ? 1U : 0U, 0, 0, 0);
+}
+
+static inline bool cactus_ind_msg_recv_in_place(struct ffa_value ret)
+{
+	return (ret.arg4 & 1U) != 0U;
+}
+
+static inline uint64_t cactus_ind_msg_recv_get_sum(struct ffa_value ret)
+{
+	return (uint64_t)ret.arg4;
+}
+
+static inline uint32_t cactus_ind_msg_recv_get_size(struct ffa_value ret)
+{
+	return (uint32_t)ret.arg5;
+}
+
+static inline ffa_id_t cactus_ind_msg_recv_get_sender(struct ffa_value ret)
+{
+	return (ffa_id_t)ret.arg6;
+}
+
 static inline uint64_t cactus_msg_send_flags(struct ffa_value ret)
 {
 	return (uint64_t)ret.arg4;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -956,6 +956,25 @@ uint32_t ffa_memory_fragment_init(
 	const struct ffa_memory_region_constituent constituents[],
 	uint32_t constituent_count, uint32_t *fragment_length);
 
+uint32_t ffa_memory_constituents_coalesce(
+	struct ffa_memory_region_constituent constituents[],
+	uint32_t constituent_count);
+
+uint32_t ffa_memory_constituents_from_pages(
+	struct ffa_memory_region_constituent constituents[],
+	uint32_t constituents_max, uintptr_t pages[], uint32_t page_count);
+
+uint32_t ffa_memory_region_init_coalesced(
+	struct ffa_memory_region *memory_region, size_t memory_region_max_size,
+	ffa_id_t sender, struct ffa_memory_access receivers[],
+	uint32_t receiver_count,
+	struct ffa_memory_region_constituent constituents[],
+	uint32_t *constituent_count, uint32_t tag,
+	ffa_memory_region_flags_t flags, enum ffa_memory_type type,
+	enum ffa_memory_cacheability cacheability,
+	enum ffa_memory_shareability shareability, uint32_t *total_length,
+	uint32_t *fragment_length);
+
 static inline ffa_id_t ffa_dir_msg_dest(struct ffa_value val) {
 	return (ffa_id_t)val.arg1 & U(0xFFFF);
 }
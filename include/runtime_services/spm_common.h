@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -67,6 +67,8 @@ struct ffa_features_test {
 struct mailbox_buffers {
 	void *recv;
 	void *send;
+	/* Size of each of the buffers, in bytes, a multiple of PAGE_SIZE */
+	size_t size;
 };
 
 #define CONFIGURE_MAILBOX(mb_name, buffers_size) 				\
@@ -78,6 +80,7 @@ struct mailbox_buffers {
 	} __aligned(PAGE_SIZE) mb_buffers;					\
 	mb_name.recv = (void *)mb_buffers.rx;					\
 	mb_name.send = (void *)mb_buffers.tx;					\
+	mb_name.size = buffers_size;						\
 	} while (false)
 
 #define CONFIGURE_AND_MAP_MAILBOX(mb_name, buffers_size, smc_ret)		\
@@ -136,7 +139,7 @@ bool memory_relinquish(struct ffa_mem_relinquish *m, uint64_t handle,
 		       ffa_id_t id);
 
 ffa_memory_handle_t memory_send(
-	void *send_buffer, uint32_t mem_func,
+	void *send_buffer, size_t send_buffer_size, uint32_t mem_func,
 	const struct ffa_memory_region_constituent *constituents,
 	uint32_t constituent_count, uint32_t remaining_constituent_count,
 	uint32_t fragment_length, uint32_t total_length,
@@ -163,6 +166,20 @@ bool ffa_partition_info_regs_helper(const struct ffa_uuid uuid,
 		       const uint16_t desc_count_per_invocation,
 		       const uint16_t desc_count_total);
 
+/* Largest number of partition info descriptors held by the discovery cache */
+#define FFA_PARTITION_INFO_CACHE_MAX	U(16)
+
+bool ffa_partition_info_cache_populate(struct mailbox_buffers *mb);
+void ffa_partition_info_cache_invalidate(void);
+bool ffa_partition_info_cache_get(struct mailbox_buffers *mb,
+				  const struct ffa_uuid uuid,
+				  struct ffa_partition_info *info,
+				  uint32_t info_max, uint32_t *count);
+bool ffa_partition_info_cache_helper(struct mailbox_buffers *mb,
+				     const struct ffa_uuid uuid,
+				     const struct ffa_partition_info *expected,
+				     const uint16_t expected_size);
+
 struct ffa_memory_access ffa_memory_access_init_permissions_from_mem_func(
 	ffa_id_t receiver_id,
 	uint32_t mem_func);
@@ -173,4 +190,15 @@ bool receive_indirect_message(void *buffer, size_t buffer_size, void *recv,
 struct ffa_value send_indirect_message(
 		ffa_id_t from, ffa_id_t to, void *send, const void *payload,
 		size_t payload_size, uint32_t send_flags);
+
+/*
+ * Zero-copy indirect messaging: the payload is written in place in the TX
+ * buffer before FFA_MSG_SEND2, and parsed in place in the RX buffer before
+ * it is released.
+ */
+void *indirect_message_tx_reserve(ffa_id_t from, ffa_id_t to, void *send,
+				  size_t payload_size);
+const void *indirect_message_rx_borrow(const void *recv, ffa_id_t receiver,
+				       ffa_id_t *sender, size_t *payload_size);
+bool indirect_message_rx_release(ffa_id_t receiver, ffa_id_t own_id);
 #endif /* SPM_COMMON_H */
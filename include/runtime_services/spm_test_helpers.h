@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,6 +12,9 @@
 #include <ffa_svc.h>
 #include <spm_common.h>
 
+/* Largest RX/TX buffers, in pages, the TFTF global mailbox can be mapped with */
+#define TFTF_MAILBOX_MAX_PAGES		U(8)
+
 #define SKIP_TEST_IF_FFA_VERSION_LESS_THAN(major, minor)			\
 	do {									\
 		struct ffa_value ret = ffa_version(FFA_VERSION_COMPILED);	\
@@ -91,6 +94,16 @@ bool reset_tftf_mailbox(void);
  */
 bool get_tftf_mailbox(struct mailbox_buffers *mb);
 
+/*
+ * Helper function to map the TFTF global mailbox with RX/TX buffers of
+ * 'page_count' pages, up to TFTF_MAILBOX_MAX_PAGES. Larger buffers let the
+ * memory sharing helpers send transaction descriptors in fewer fragments.
+ * The buffers which are currently mapped are unmapped first. If the SPMC
+ * doesn't accept the new size, it returns false and the mailbox is left
+ * unmapped, to be mapped with a single page by the next get_tftf_mailbox().
+ */
+bool configure_tftf_mailbox(uint32_t page_count);
+
 /*
  * Call FFA_VERSION and check that it returns the expected version.
  */
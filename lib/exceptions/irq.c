@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -26,9 +26,21 @@
  * different SPIs' handlers at the same time (although it would be fine) but it
  * saves memory. Updating an SPI handler shouldn't occur that often anyway so we
  * shouldn't suffer from this restriction too much.
+ *
+ * The lock only serialises the updates: the dispatcher never takes it. A new
+ * handler is published with a single store-release, which the dispatcher pairs
+ * with a load-acquire, and unregistering a handler waits for the CPUs which
+ * might still be running it, see irq_wait_for_dispatchers().
  */
 static spinlock_t shared_irq_lock;
 
+/*
+ * Dispatch sequence number of each CPU. It is odd while the CPU dispatches an
+ * interrupt, from before it loads the handler until after the handler returns.
+ */
+static struct {
+	unsigned int seq;
+} __aligned(CACHE_WRITEBACK_GRANULE) dispatch_seq[PLATFORM_CORE_COUNT];
 
 unsigned int tftf_irq_get_my_sgi_num(unsigned int seq_id)
 {
@@ -57,6 +69,45 @@ void tftf_send_sgi(unsigned int sgi_id, unsigned int core_pos)
 	arm_gic_send_sgi(sgi_id, core_pos);
 }
 
+void tftf_send_sgi_multicast(unsigned int sgi_id, const bool *targets)
+{
+	/*
+	 * Ensure that all memory accesses prior to sending the SGI are
+	 * completed.
+	 */
+	dsbish();
+
+	/* See tftf_send_sgi() */
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++)
+		assert(!targets[i] || tftf_is_core_pos_online(i));
+
+	arm_gic_send_sgi_multicast(sgi_id, targets);
+}
+
+void tftf_send_sgi_others(unsigned int sgi_id)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	bool targets[PLATFORM_CORE_COUNT];
+	bool all_online = true;
+
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		targets[i] = (i != core_pos) && tftf_is_core_pos_online(i);
+		if ((i != core_pos) && !targets[i])
+			all_online = false;
+	}
+
+	dsbish();
+
+	/*
+	 * Broadcasting the SGI would also reach the cores which are being
+	 * powered on or off, so only do it when all of them are online.
+	 */
+	if (all_online)
+		arm_gic_send_sgi_others(sgi_id);
+	else
+		arm_gic_send_sgi_multicast(sgi_id, targets);
+}
+
 void tftf_irq_enable(unsigned int irq_num, uint8_t irq_priority)
 {
 	arm_gic_set_intr_target(irq_num, platform_get_core_pos(read_mpidr_el1()));
@@ -91,30 +142,71 @@ void tftf_irq_disable_sgi(unsigned int sgi_id)
 #define HANDLER_VALID(handler, expect_handler)		\
 	((expect_handler) ? ((handler) != NULL) : ((handler) == NULL))
 
+/*
+ * Wait until the other CPUs which were dispatching an interrupt when this
+ * function was called are done with it. After a shared handler has been
+ * unpublished, this guarantees that none of them still runs it.
+ */
+static void irq_wait_for_dispatchers(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	unsigned int seq;
+
+	/* Order the update of the handler before reading the sequences */
+	dmbish();
+
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		/* The calling CPU may be unregistering from a handler */
+		if (i == core_pos)
+			continue;
+
+		seq = __atomic_load_n(&dispatch_seq[i].seq, __ATOMIC_ACQUIRE);
+		if ((seq & 1U) == 0U)
+			continue;
+
+		while (__atomic_load_n(&dispatch_seq[i].seq,
+				       __ATOMIC_ACQUIRE) == seq)
+			;
+	}
+}
+
 static int tftf_irq_update_handler(unsigned int irq_num,
 				   irq_handler_t irq_handler,
 				   bool expect_handler)
 {
-	irq_handler_t *cur_handler;
+	irq_desc_t *desc;
+	bool shared = arm_gic_is_irq_shared(irq_num);
 	int ret = -1;
 
-	cur_handler = arm_gic_get_irq_handler(irq_num);
-	if (arm_gic_is_irq_shared(irq_num))
+	desc = arm_gic_get_irq_desc(irq_num);
+	if (shared)
 		spin_lock(&shared_irq_lock);
 
 	/*
 	 * Update the IRQ handler, if the current handler is in the expected
-	 * state
+	 * state. The statistics of a new handler start from scratch: they are
+	 * only updated along with a call to the handler, so no CPU can be
+	 * writing them at this point.
 	 */
-	assert(HANDLER_VALID(*cur_handler, expect_handler));
-	if (HANDLER_VALID(*cur_handler, expect_handler)) {
-		*cur_handler = irq_handler;
+	assert(HANDLER_VALID(desc->handler, expect_handler));
+	if (HANDLER_VALID(desc->handler, expect_handler)) {
+		if (irq_handler != NULL)
+			memset(&desc->stats, 0, sizeof(desc->stats));
+		__atomic_store_n(&desc->handler, irq_handler,
+				 __ATOMIC_RELEASE);
 		ret = 0;
 	}
 
-	if (arm_gic_is_irq_shared(irq_num))
+	if (shared)
 		spin_unlock(&shared_irq_lock);
 
+	/*
+	 * A banked handler is only ever called on the calling CPU, but other
+	 * CPUs might still be running a shared one.
+	 */
+	if (shared && (ret == 0) && (irq_handler == NULL))
+		irq_wait_for_dispatchers();
+
 	return ret;
 }
 
@@ -153,22 +245,75 @@ int tftf_irq_unregister_handler_sgi(unsigned int sgi_id)
 	return tftf_irq_unregister_handler(irq_num);
 }
 
+int tftf_irq_get_stats(unsigned int irq_num, irq_stats_t *stats)
+{
+	irq_desc_t *desc;
+
+	assert(stats != NULL);
+
+	if (irq_num == GIC_SPURIOUS_INTERRUPT)
+		return -1;
+
+	desc = arm_gic_get_irq_desc(irq_num);
+	if (desc->handler == NULL)
+		return -1;
+
+	*stats = desc->stats;
+
+	return 0;
+}
+
+int tftf_irq_get_stats_sgi(unsigned int sgi_id, irq_stats_t *stats)
+{
+	unsigned int irq_num = tftf_irq_get_my_sgi_num(sgi_id);
+	return tftf_irq_get_stats(irq_num, stats);
+}
+
 int tftf_irq_handler_dispatcher(void)
 {
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
 	unsigned int raw_iar;
 	unsigned int irq_num;
-	irq_handler_t *handler;
+	irq_desc_t *desc;
+	irq_handler_t handler;
 	void *irq_data = NULL;
+	uint64_t start, ticks;
 	int rc = 0;
 
 	/* Acknowledge the interrupt */
 	irq_num = arm_gic_intr_ack(&raw_iar);
 
-	handler = arm_gic_get_irq_handler(irq_num);
+	desc = arm_gic_get_irq_desc(irq_num);
 	irq_data = &irq_num;
 
-	if (*handler != NULL)
-		rc = (*handler)(irq_data);
+	/*
+	 * Tell the CPUs unregistering a shared handler that we might be using
+	 * it before loading it. Nothing else writes the sequence of this CPU.
+	 */
+	dispatch_seq[core_pos].seq++;
+	dmbish();
+
+	handler = __atomic_load_n(&desc->handler, __ATOMIC_ACQUIRE);
+	if (handler != NULL) {
+		start = read_cntpct_el0();
+		rc = handler(irq_data);
+		ticks = read_cntpct_el0() - start;
+
+		/*
+		 * An SPI can't be active on several CPUs at the same time, and
+		 * an LPI is only ever routed to one of them, so the statistics
+		 * of a shared interrupt only have one writer at a time. This
+		 * doesn't hold for the spurious interrupt.
+		 */
+		if (irq_num != GIC_SPURIOUS_INTERRUPT) {
+			desc->stats.count++;
+			if (ticks > desc->stats.max_ticks)
+				desc->stats.max_ticks = ticks;
+		}
+	}
+
+	__atomic_store_n(&dispatch_seq[core_pos].seq,
+			 dispatch_seq[core_pos].seq + 1U, __ATOMIC_RELEASE);
 
 	/* Mark the processing of the interrupt as complete */
 	if (irq_num != GIC_SPURIOUS_INTERRUPT)
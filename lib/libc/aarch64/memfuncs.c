@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <arch_features.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Implementations of memcpy() and memset() selected by memfuncs_init(). They
+ * are set at runtime rather than statically initialised so that they are
+ * valid in position independent images before their relocations are fixed.
+ */
+static void *(*memcpy_impl)(void *dst, const void *src, size_t len);
+static void *(*memset_impl)(void *dst, int val, size_t count);
+
+void memfuncs_init(void)
+{
+	if (is_feat_mops_present()) {
+		memcpy_impl = memcpy_mops;
+		memset_impl = memset_mops;
+	} else {
+		memcpy_impl = memcpy_generic;
+		memset_impl = memset_generic;
+	}
+}
+
+void *memcpy(void *dst, const void *src, size_t len)
+{
+	if (memcpy_impl != NULL) {
+		return memcpy_impl(dst, src, len);
+	}
+
+	return memcpy_generic(dst, src, len);
+}
+
+void *memset(void *dst, int val, size_t count)
+{
+	if (memset_impl != NULL) {
+		return memset_impl(dst, val, count);
+	}
+
+	return memset_generic(dst, val, count);
+}
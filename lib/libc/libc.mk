@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2016-2019, ARM Limited and Contributors. All rights reserved.
+# Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -16,6 +16,7 @@ LIBC_SRCS	:=	$(addprefix lib/libc/,		\
 			printf.c			\
 			putchar.c			\
 			puts.c				\
+			qsort.c				\
 			rand.c				\
 			snprintf.c			\
 			strchr.c			\
@@ -25,10 +26,13 @@ LIBC_SRCS	:=	$(addprefix lib/libc/,		\
 			strncmp.c			\
 			strncpy.c			\
 			strnlen.c			\
-			strrchr.c)
+			strrchr.c			\
+			vformat.c)
 
 ifeq (${ARCH},aarch64)
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch64/,	\
+			memfuncs.c			\
+			memfuncs_mops.S			\
 			setjmp.S)
 endif
 
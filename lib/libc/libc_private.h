@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LIBC_PRIVATE_H
+#define LIBC_PRIVATE_H
+
+#include <stdarg.h>
+#include <stddef.h>
+
+/*
+ * Output of the formatting engine. Characters are stored in 'buf'. When it is
+ * full, 'flush' is called to drain it if set, otherwise further characters
+ * are dropped. 'count' is the total number of characters produced.
+ */
+struct fmt_sink {
+	char *buf;
+	size_t size;
+	size_t pos;
+	size_t count;
+	void (*flush)(struct fmt_sink *sink);
+};
+
+int libc_vformat(struct fmt_sink *sink, const char **fmt_p, va_list args);
+
+#endif /* LIBC_PRIVATE_H */
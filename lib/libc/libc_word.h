@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LIBC_WORD_H
+#define LIBC_WORD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Helpers for the string functions that process memory one native word at a
+ * time.
+ *
+ * Unaligned accesses can't be used: the MMU may be disabled or the buffers
+ * may be mapped as Device memory, and the code is built with -mstrict-align.
+ * Whole words are only accessed when all the buffers involved can be aligned
+ * to a word boundary at the same time.
+ */
+typedef unsigned long __attribute__((__may_alias__)) libc_word_t;
+
+#define LIBC_WORD_SIZE		sizeof(libc_word_t)
+#define LIBC_WORD_MASK		(LIBC_WORD_SIZE - 1U)
+
+/* Word with all its bytes set to 0x01 and to 0x80, respectively. */
+#define LIBC_WORD_ONES		(~0UL / 0xFFUL)
+#define LIBC_WORD_HIGHS		(LIBC_WORD_ONES << 7)
+
+/* Returns a word with all its bytes set to the given value. */
+static inline libc_word_t libc_word_splat(unsigned char c)
+{
+	return LIBC_WORD_ONES * c;
+}
+
+/* Returns true if any of the bytes of the given word is zero. */
+static inline bool libc_word_has_zero(libc_word_t w)
+{
+	return ((w - LIBC_WORD_ONES) & ~w & LIBC_WORD_HIGHS) != 0UL;
+}
+
+/* Returns true if both addresses have the same alignment within a word. */
+static inline bool libc_word_coaligned(const void *a, const void *b)
+{
+	return (((uintptr_t)a ^ (uintptr_t)b) & LIBC_WORD_MASK) == 0U;
+}
+
+static inline bool libc_word_aligned(const void *a)
+{
+	return ((uintptr_t)a & LIBC_WORD_MASK) == 0U;
+}
+
+#endif /* LIBC_WORD_H */
@@ -1,11 +1,13 @@
 /*
- * Copyright (c) 2013-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <stddef.h>
 
+#include "libc_word.h"
+
 int memcmp(const void *s1, const void *s2, size_t len)
 {
 	const unsigned char *s = s1;
@@ -13,6 +15,27 @@ int memcmp(const void *s1, const void *s2, size_t len)
 	unsigned char sc;
 	unsigned char dc;
 
+	if (libc_word_coaligned(s, d)) {
+		while (!libc_word_aligned(s) && (len != 0U)) {
+			sc = *s++;
+			dc = *d++;
+			if (sc - dc)
+				return (sc - dc);
+			len--;
+		}
+
+		/*
+		 * Skip the words that are identical. The first word that
+		 * differs is compared byte by byte below to find the result.
+		 */
+		while ((len >= LIBC_WORD_SIZE) &&
+		       (*(const libc_word_t *)s == *(const libc_word_t *)d)) {
+			s += LIBC_WORD_SIZE;
+			d += LIBC_WORD_SIZE;
+			len -= LIBC_WORD_SIZE;
+		}
+	}
+
 	while (len--) {
 		sc = *s++;
 		dc = *d++;
@@ -1,18 +1,59 @@
 /*
- * Copyright (c) 2013-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <stddef.h>
+#include <string.h>
 
-void *memcpy(void *dst, const void *src, size_t len)
+#include "libc_word.h"
+
+void *memcpy_generic(void *dst, const void *src, size_t len)
 {
 	const char *s = src;
 	char *d = dst;
 
+	if (libc_word_coaligned(d, s)) {
+		const libc_word_t *ws;
+		libc_word_t *wd;
+
+		while (!libc_word_aligned(d) && (len != 0U)) {
+			*d++ = *s++;
+			len--;
+		}
+
+		wd = (libc_word_t *)d;
+		ws = (const libc_word_t *)s;
+
+		while (len >= (4U * LIBC_WORD_SIZE)) {
+			wd[0] = ws[0];
+			wd[1] = ws[1];
+			wd[2] = ws[2];
+			wd[3] = ws[3];
+			wd += 4;
+			ws += 4;
+			len -= 4U * LIBC_WORD_SIZE;
+		}
+
+		while (len >= LIBC_WORD_SIZE) {
+			*wd++ = *ws++;
+			len -= LIBC_WORD_SIZE;
+		}
+
+		d = (char *)wd;
+		s = (const char *)ws;
+	}
+
 	while (len--)
 		*d++ = *s++;
 
 	return dst;
 }
+
+#ifndef __aarch64__
+void *memcpy(void *dst, const void *src, size_t len)
+{
+	return memcpy_generic(dst, src, len);
+}
+#endif
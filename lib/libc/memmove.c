@@ -1,11 +1,13 @@
 /*
- * Copyright (c) 2013-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <string.h>
 
+#include "libc_word.h"
+
 void *memmove(void *dst, const void *src, size_t len)
 {
 	/*
@@ -24,6 +26,18 @@ void *memmove(void *dst, const void *src, size_t len)
 		const char *end = dst;
 		const char *s = (const char *)src + len;
 		char *d = (char *)dst + len;
+
+		if (libc_word_coaligned(d, s)) {
+			while (!libc_word_aligned(d) && (d != end))
+				*--d = *--s;
+
+			while ((size_t)(d - end) >= LIBC_WORD_SIZE) {
+				d -= LIBC_WORD_SIZE;
+				s -= LIBC_WORD_SIZE;
+				*(libc_word_t *)d = *(const libc_word_t *)s;
+			}
+		}
+
 		while (d != end)
 			*--d = *--s;
 	}
@@ -1,17 +1,52 @@
 /*
- * Copyright (c) 2013-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <stddef.h>
+#include <string.h>
 
-void *memset(void *dst, int val, size_t count)
+#include "libc_word.h"
+
+void *memset_generic(void *dst, int val, size_t count)
 {
 	char *ptr = dst;
+	libc_word_t pattern, *wptr;
+
+	while (!libc_word_aligned(ptr) && (count != 0U)) {
+		*ptr++ = val;
+		count--;
+	}
+
+	pattern = libc_word_splat((unsigned char)val);
+	wptr = (libc_word_t *)ptr;
+
+	while (count >= (4U * LIBC_WORD_SIZE)) {
+		wptr[0] = pattern;
+		wptr[1] = pattern;
+		wptr[2] = pattern;
+		wptr[3] = pattern;
+		wptr += 4;
+		count -= 4U * LIBC_WORD_SIZE;
+	}
+
+	while (count >= LIBC_WORD_SIZE) {
+		*wptr++ = pattern;
+		count -= LIBC_WORD_SIZE;
+	}
+
+	ptr = (char *)wptr;
 
 	while (count--)
 		*ptr++ = val;
 
 	return dst;
 }
+
+#ifndef __aarch64__
+void *memset(void *dst, int val, size_t count)
+{
+	return memset_generic(dst, val, count);
+}
+#endif
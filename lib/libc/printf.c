@@ -1,108 +1,28 @@
 /*
- * Copyright (c) 2014-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include <assert.h>
 #include <stdarg.h>
-#include <stdbool.h>
-#include <stdint.h>
+#include <stdio.h>
 
-#include <common/debug.h>
+#include "libc_private.h"
 
-#define get_num_va_args(_args, _lcount)				\
-	(((_lcount) > 1)  ? va_arg(_args, long long int) :	\
-	(((_lcount) == 1) ? va_arg(_args, long int) :		\
-			    va_arg(_args, int)))
+/* Size of the on-stack buffer that vprintf() formats into. */
+#define PRINTF_BUF_SIZE		128U
 
-#define get_unum_va_args(_args, _lcount)				\
-	(((_lcount) > 1)  ? va_arg(_args, unsigned long long int) :	\
-	(((_lcount) == 1) ? va_arg(_args, unsigned long int) :		\
-			    va_arg(_args, unsigned int)))
-
-static int string_print(const char *str, char padc, int padn)
-{
-	int i = 0, count = 0;
-
-	assert(str != NULL);
-
-	while (str[i] != '\0')
-		i++;
-
-	if (padn > 0) {
-		while (i < padn) {
-			(void)putchar(padc);
-			count++;
-			padn--;
-		}
-	}
-
-	for ( ; *str != '\0'; str++) {
-		(void)putchar(*str);
-		count++;
-	}
-
-	if (padn < 0) {
-		while (i < -padn) {
-			(void)putchar(padc);
-			count++;
-			padn++;
-		}
-	}
-
-	return count;
-}
-
-static int unsigned_num_print(unsigned long long int unum, unsigned int radix,
-			      char padc, int padn)
+static void printf_flush(struct fmt_sink *sink)
 {
-	/* Just need enough space to store 64 bit decimal integer */
-	char num_buf[20];
-	int i = 0, count = 0;
-	int width;
-	unsigned int rem;
-
-	do {
-		rem = unum % radix;
-		if (rem < 0xa)
-			num_buf[i] = '0' + rem;
-		else
-			num_buf[i] = 'a' + (rem - 0xa);
-		i++;
-		unum /= radix;
-	} while (unum > 0U);
-
-	width = i;
-
-	if (padn > 0) {
-		while (width < padn) {
-			(void)putchar(padc);
-			count++;
-			padn--;
-		}
-	}
-
-	while (--i >= 0) {
-		(void)putchar(num_buf[i]);
-		count++;
-	}
-
-	if (padn < 0) {
-		while (width < -padn) {
-			(void)putchar(padc);
-			count++;
-			padn++;
-		}
-	}
-
-	return count;
+	for (size_t i = 0U; i < sink->pos; i++)
+		(void)putchar(sink->buf[i]);
 }
 
 /*******************************************************************
  * Simplified version of printf() with smaller memory footprint.
  * The following type specifiers are supported by this print
  * %x - hexadecimal format
+ * %o - octal format
  * %s - string format
  * %d or %i - signed decimal format
  * %u - unsigned decimal format
@@ -123,117 +43,21 @@ static int unsigned_num_print(unsigned long long int unum, unsigned int radix,
  *******************************************************************/
 int vprintf(const char *fmt, va_list args)
 {
-	int l_count;
-	int left;
-	long long int num;
-	unsigned long long int unum;
-	char *str;
-	char padc; /* Padding character */
-	int padn; /* Number of characters to pad */
-	int count = 0; /* Number of printed characters */
-
-	while (*fmt != '\0') {
-		l_count = 0;
-		left = 0;
-		padc = '\0';
-		padn = 0;
-
-		if (*fmt == '%') {
-			fmt++;
-			/* Check the format specifier */
-loop:
-			switch (*fmt) {
-			case '1':
-			case '2':
-			case '3':
-			case '4':
-			case '5':
-			case '6':
-			case '7':
-			case '8':
-			case '9':
-				padc = ' ';
-				for (padn = 0; *fmt >= '0' && *fmt <= '9'; fmt++)
-					padn = (padn * 10) + (*fmt - '0');
-				if (left)
-					padn = -padn;
-				goto loop;
-			case '-':
-				left = 1;
-				fmt++;
-				goto loop;
-			case 'i': /* Fall through to next one */
-			case 'd':
-				num = get_num_va_args(args, l_count);
-				if (num < 0) {
-					(void)putchar('-');
-					unum = (unsigned long long int)-num;
-					padn--;
-				} else
-					unum = (unsigned long long int)num;
-
-				count += unsigned_num_print(unum, 10,
-							    padc, padn);
-				break;
-			case 's':
-				str = va_arg(args, char *);
-				count += string_print(str, padc, padn);
-				break;
-			case 'p':
-				unum = (uintptr_t)va_arg(args, void *);
-				if (unum > 0U) {
-					count += string_print("0x", padc, 0);
-					padn -= 2;
-				}
-
-				count += unsigned_num_print(unum, 16,
-							    padc, padn);
-				break;
-			case 'x':
-				unum = get_unum_va_args(args, l_count);
-				count += unsigned_num_print(unum, 16,
-							    padc, padn);
-				break;
-			case 'z':
-				if (sizeof(size_t) == 8U)
-					l_count = 2;
-
-				fmt++;
-				goto loop;
-			case 'l':
-				l_count++;
-				fmt++;
-				goto loop;
-			case 'u':
-				unum = get_unum_va_args(args, l_count);
-				count += unsigned_num_print(unum, 10,
-							    padc, padn);
-				break;
-			case '0':
-				padc = '0';
-				padn = 0;
-				fmt++;
+	char buf[PRINTF_BUF_SIZE];
+	struct fmt_sink sink = {
+		.buf = buf,
+		.size = sizeof(buf),
+		.flush = printf_flush,
+	};
+	int count;
 
-				for (;;) {
-					char ch = *fmt;
-					if ((ch < '0') || (ch > '9')) {
-						goto loop;
-					}
-					padn = (padn * 10) + (ch - '0');
-					fmt++;
-				}
-				assert(0); /* Unreachable */
-			default:
-				/* Exit on any other format specifier */
-				return -1;
-			}
-			fmt++;
-			continue;
-		}
-		(void)putchar(*fmt);
-		fmt++;
-		count++;
-	}
+	/*
+	 * Format into the buffer and only hand it to the console when it is
+	 * full or at the end, rather than interleaving the formatting and the
+	 * output of each character.
+	 */
+	count = libc_vformat(&sink, &fmt, args);
+	printf_flush(&sink);
 
 	return count;
 }
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdlib.h>
+
+static void qsort_swap(unsigned char *a, unsigned char *b, size_t size)
+{
+	unsigned char tmp;
+
+	while (size-- > 0U) {
+		tmp = *a;
+		*a++ = *b;
+		*b++ = tmp;
+	}
+}
+
+static void qsort_sift_down(unsigned char *base, size_t root, size_t count,
+			    size_t size, int (*compar)(const void *, const void *))
+{
+	size_t child;
+
+	while ((child = (2U * root) + 1U) < count) {
+		if (((child + 1U) < count) &&
+		    (compar(base + (child * size),
+			    base + ((child + 1U) * size)) < 0)) {
+			child++;
+		}
+
+		if (compar(base + (root * size), base + (child * size)) >= 0) {
+			return;
+		}
+
+		qsort_swap(base + (root * size), base + (child * size), size);
+		root = child;
+	}
+}
+
+/*
+ * Implemented as a heap sort: it doesn't recurse, needs no extra memory and
+ * its worst case stays O(n log n). Like qsort() in any libc, it isn't stable.
+ */
+void qsort(void *base, size_t nmemb, size_t size,
+	   int (*compar)(const void *, const void *))
+{
+	unsigned char *array = base;
+
+	if ((nmemb < 2U) || (size == 0U)) {
+		return;
+	}
+
+	for (size_t i = nmemb / 2U; i > 0U; i--) {
+		qsort_sift_down(array, i - 1U, nmemb, size, compar);
+	}
+
+	for (size_t end = nmemb - 1U; end > 0U; end--) {
+		qsort_swap(array, array + (end * size), size);
+		qsort_sift_down(array, 0U, end, size, compar);
+	}
+}
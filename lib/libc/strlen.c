@@ -1,15 +1,33 @@
 /*
- * Copyright (c) 2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <string.h>
 
+#include "libc_word.h"
+
 size_t strlen(const char *s)
 {
 	const char *cursor = s;
+	const libc_word_t *wcursor;
+
+	while (!libc_word_aligned(cursor)) {
+		if (*cursor == '\0')
+			return cursor - s;
+		cursor++;
+	}
+
+	/*
+	 * Reading a whole aligned word never crosses a page boundary, so it is
+	 * safe to read past the terminator within the last word.
+	 */
+	wcursor = (const libc_word_t *)cursor;
+	while (!libc_word_has_zero(*wcursor))
+		wcursor++;
 
+	cursor = (const char *)wcursor;
 	while (*cursor)
 		cursor++;
 
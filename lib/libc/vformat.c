@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2014-2026, ARM Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdint.h>
+
+#include "libc_private.h"
+
+#define get_num_va_args(_args, _lcount)				\
+	(((_lcount) > 1)  ? va_arg(_args, long long int) :	\
+	(((_lcount) == 1) ? va_arg(_args, long int) :		\
+			    va_arg(_args, int)))
+
+#define get_unum_va_args(_args, _lcount)				\
+	(((_lcount) > 1)  ? va_arg(_args, unsigned long long int) :	\
+	(((_lcount) == 1) ? va_arg(_args, unsigned long int) :		\
+			    va_arg(_args, unsigned int)))
+
+/* Enough space to store a 64 bit integer in octal format */
+#define NUM_BUF_SIZE	22
+
+static const char fmt_digits[] = "0123456789abcdef";
+
+static void fmt_putc(struct fmt_sink *sink, char c)
+{
+	if ((sink->pos == sink->size) && (sink->flush != NULL)) {
+		sink->flush(sink);
+		sink->pos = 0U;
+	}
+
+	/* Without a flush callback, characters that don't fit are dropped. */
+	if (sink->pos < sink->size) {
+		sink->buf[sink->pos] = c;
+		sink->pos++;
+	}
+
+	sink->count++;
+}
+
+static void fmt_pad(struct fmt_sink *sink, char padc, int width, int padn)
+{
+	while (width < padn) {
+		fmt_putc(sink, padc);
+		width++;
+	}
+}
+
+static void fmt_string(struct fmt_sink *sink, const char *str, char padc,
+		       int padn)
+{
+	int width = 0;
+
+	assert(str != NULL);
+
+	while (str[width] != '\0')
+		width++;
+
+	if (padn > 0)
+		fmt_pad(sink, padc, width, padn);
+
+	for ( ; *str != '\0'; str++)
+		fmt_putc(sink, *str);
+
+	if (padn < 0)
+		fmt_pad(sink, padc, width, -padn);
+}
+
+/*
+ * Convert 'unum' to a string that ends at 'end', and return the number of
+ * digits. Power of two radixes only need shifts and masks. For decimal, the
+ * division by the constant 10 is turned into a multiplication by its
+ * reciprocal, and the loop moves to 32-bit arithmetic as soon as the value
+ * fits, which is the common case.
+ */
+static int fmt_utoa(char *end, unsigned long long int unum, unsigned int radix)
+{
+	char *p = end;
+
+	if (radix != 10U) {
+		unsigned int shift = (radix == 16U) ? 4U : 3U;
+		unsigned int mask = radix - 1U;
+
+		do {
+			*--p = fmt_digits[unum & mask];
+			unum >>= shift;
+		} while (unum != 0U);
+
+		return (int)(end - p);
+	}
+
+	while (unum > UINT32_MAX) {
+		unsigned long long int q = unum / 10U;
+
+		*--p = (char)('0' + (unum - (q * 10U)));
+		unum = q;
+	}
+
+	for (uint32_t num32 = (uint32_t)unum; ; ) {
+		uint32_t q = num32 / 10U;
+
+		*--p = (char)('0' + (num32 - (q * 10U)));
+		num32 = q;
+		if (num32 == 0U)
+			break;
+	}
+
+	return (int)(end - p);
+}
+
+/*
+ * Print a number with an optional prefix ("-" or "0x"), which counts towards
+ * the width. Zero padding goes between the prefix and the digits.
+ */
+static void fmt_number(struct fmt_sink *sink, unsigned long long int unum,
+		       unsigned int radix, const char *prefix, char padc,
+		       int padn)
+{
+	char num_buf[NUM_BUF_SIZE];
+	int digits = fmt_utoa(&num_buf[NUM_BUF_SIZE], unum, radix);
+	int width = digits;
+
+	for (const char *c = prefix; *c != '\0'; c++)
+		width++;
+
+	if ((padn > 0) && (padc != '0'))
+		fmt_pad(sink, padc, width, padn);
+
+	for ( ; *prefix != '\0'; prefix++)
+		fmt_putc(sink, *prefix);
+
+	if ((padn > 0) && (padc == '0'))
+		fmt_pad(sink, padc, width, padn);
+
+	for (int i = NUM_BUF_SIZE - digits; i < NUM_BUF_SIZE; i++)
+		fmt_putc(sink, num_buf[i]);
+
+	if (padn < 0)
+		fmt_pad(sink, padc, width, -padn);
+}
+
+/*
+ * Formatting engine shared by vprintf() and vsnprintf(). See vprintf() for
+ * the list of supported specifiers.
+ *
+ * It returns the number of characters produced, or -1 on an unsupported
+ * specifier, in which case 'fmt' is left pointing at it.
+ */
+int libc_vformat(struct fmt_sink *sink, const char **fmt_p, va_list args)
+{
+	const char *fmt = *fmt_p;
+	int l_count;
+	int left;
+	long long int num;
+	unsigned long long int unum;
+	char *str;
+	char padc; /* Padding character */
+	int padn; /* Number of characters to pad */
+
+	while (*fmt != '\0') {
+		l_count = 0;
+		left = 0;
+		padc = '\0';
+		padn = 0;
+
+		if (*fmt == '%') {
+			fmt++;
+			/* Check the format specifier */
+loop:
+			switch (*fmt) {
+			case '1':
+			case '2':
+			case '3':
+			case '4':
+			case '5':
+			case '6':
+			case '7':
+			case '8':
+			case '9':
+				padc = ' ';
+				for (padn = 0; *fmt >= '0' && *fmt <= '9'; fmt++)
+					padn = (padn * 10) + (*fmt - '0');
+				if (left)
+					padn = -padn;
+				goto loop;
+			case '-':
+				left = 1;
+				fmt++;
+				goto loop;
+			case 'i': /* Fall through to next one */
+			case 'd':
+				num = get_num_va_args(args, l_count);
+				if (num < 0) {
+					unum = -(unsigned long long int)num;
+					fmt_number(sink, unum, 10, "-", padc, padn);
+				} else {
+					unum = (unsigned long long int)num;
+					fmt_number(sink, unum, 10, "", padc, padn);
+				}
+				break;
+			case 's':
+				str = va_arg(args, char *);
+				fmt_string(sink, str, padc, padn);
+				break;
+			case 'p':
+				unum = (uintptr_t)va_arg(args, void *);
+				fmt_number(sink, unum, 16, (unum > 0U) ? "0x" : "",
+					   padc, padn);
+				break;
+			case 'x':
+				unum = get_unum_va_args(args, l_count);
+				fmt_number(sink, unum, 16, "", padc, padn);
+				break;
+			case 'o':
+				unum = get_unum_va_args(args, l_count);
+				fmt_number(sink, unum, 8, "", padc, padn);
+				break;
+			case 'z':
+				if (sizeof(size_t) == 8U)
+					l_count = 2;
+
+				fmt++;
+				goto loop;
+			case 'l':
+				l_count++;
+				fmt++;
+				goto loop;
+			case 'u':
+				unum = get_unum_va_args(args, l_count);
+				fmt_number(sink, unum, 10, "", padc, padn);
+				break;
+			case '0':
+				padc = '0';
+				padn = 0;
+				fmt++;
+
+				for (;;) {
+					char ch = *fmt;
+					if ((ch < '0') || (ch > '9')) {
+						goto loop;
+					}
+					padn = (padn * 10) + (ch - '0');
+					fmt++;
+				}
+				assert(0); /* Unreachable */
+			default:
+				/* Exit on any other format specifier */
+				*fmt_p = fmt;
+				return -1;
+			}
+			fmt++;
+			continue;
+		}
+		fmt_putc(sink, *fmt);
+		fmt++;
+	}
+
+	*fmt_p = fmt;
+
+	return (int)sink->count;
+}
@@ -112,6 +112,11 @@ int xlat_get_mem_attributes(uintptr_t base_va, uint32_t *attr)
 	return xlat_get_mem_attributes_ctx(&tf_xlat_ctx, base_va, attr);
 }
 
+int xlat_get_desc(uintptr_t base_va, uint64_t *desc)
+{
+	return xlat_get_desc_ctx(&tf_xlat_ctx, base_va, desc);
+}
+
 int xlat_change_mem_attributes(uintptr_t base_va, size_t size, uint32_t attr)
 {
 	return xlat_change_mem_attributes_ctx(&tf_xlat_ctx, base_va, size, attr);
@@ -26,6 +26,50 @@ static inline __attribute__((unused)) void xlat_clean_dcache_range(uintptr_t add
 		clean_dcache_range(addr, size);
 }
 
+/*
+ * Clears the Contiguous hint of the group of descriptors that contains the
+ * given block or page descriptor so that it can be modified on its own. The
+ * TLBs may hold a single entry for the whole group, so all of its descriptors
+ * go through a break-before-make sequence.
+ *
+ * The other descriptors of the group are invalid for the duration of the
+ * sequence, so the caller must make sure that nothing accesses the
+ * XLAT_CONT_SIZE(level) bytes of VA space around va in the meantime.
+ */
+void xlat_clear_cont_hint(const xlat_ctx_t *ctx, uint64_t *entry,
+			  uintptr_t va, unsigned int level)
+{
+	uint64_t *group = (uint64_t *)((uintptr_t)entry &
+			~(uintptr_t)((XLAT_CONT_ENTRIES * sizeof(uint64_t)) - 1U));
+	uintptr_t group_va = va & ~(uintptr_t)XLAT_CONT_MASK(level);
+	uint64_t descs[XLAT_CONT_ENTRIES];
+
+	assert((*entry & UPPER_ATTRS(CONT_HINT)) != 0ULL);
+
+	for (unsigned int i = 0U; i < XLAT_CONT_ENTRIES; i++) {
+		descs[i] = group[i];
+		group[i] = INVALID_DESC;
+	}
+#if !(HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
+	xlat_clean_dcache_range((uintptr_t)group,
+				XLAT_CONT_ENTRIES * sizeof(uint64_t));
+#endif
+
+	for (unsigned int i = 0U; i < XLAT_CONT_ENTRIES; i++) {
+		xlat_arch_tlbi_va(group_va + (i * XLAT_BLOCK_SIZE(level)),
+				  ctx->xlat_regime);
+	}
+	xlat_arch_tlbi_va_sync();
+
+	for (unsigned int i = 0U; i < XLAT_CONT_ENTRIES; i++)
+		group[i] = descs[i] & ~UPPER_ATTRS(CONT_HINT);
+#if !(HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
+	xlat_clean_dcache_range((uintptr_t)group,
+				XLAT_CONT_ENTRIES * sizeof(uint64_t));
+#endif
+	dsbish();
+}
+
 #if PLAT_XLAT_TABLES_DYNAMIC
 
 /*
@@ -210,6 +254,125 @@ uint64_t xlat_desc(const xlat_ctx_t *ctx, uint32_t attr,
 	return desc;
 }
 
+/*
+ * Bits of a block or page descriptor that must be identical for it to be
+ * merged with its neighbours: everything except the output address and the
+ * Contiguous hint itself.
+ */
+#define XLAT_DESC_ATTRS_MASK	(~(TABLE_ADDR_MASK | UPPER_ATTRS(CONT_HINT)))
+
+/*
+ * Returns true if the 'count' descriptors starting at 'entries' are block or
+ * page descriptors of the given level that map a range of PAs that is
+ * contiguous and aligned to 'size', all of them with identical attributes.
+ */
+static bool xlat_entries_are_mergeable(const uint64_t *entries,
+				       unsigned int count, unsigned int level,
+				       size_t size)
+{
+	uint64_t leaf_desc = (level == XLAT_TABLE_LEVEL_MAX) ?
+			     PAGE_DESC : BLOCK_DESC;
+	uint64_t first_desc = entries[0];
+	unsigned long long base_pa = first_desc & TABLE_ADDR_MASK;
+
+	if (((first_desc & DESC_MASK) != leaf_desc) ||
+	    ((base_pa & ((unsigned long long)size - 1ULL)) != 0ULL))
+		return false;
+
+	for (unsigned int i = 1U; i < count; i++) {
+		uint64_t desc = entries[i];
+
+		if ((desc & DESC_MASK) != leaf_desc)
+			return false;
+
+		if ((desc & TABLE_ADDR_MASK) !=
+		    (base_pa + (unsigned long long)i * XLAT_BLOCK_SIZE(level)))
+			return false;
+
+		if (((desc ^ first_desc) & XLAT_DESC_ATTRS_MASK) != 0ULL)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Returns true if the descriptors that map the VA range [base_va, end_va] can
+ * be merged into a coarser translation (a block descriptor or a group of
+ * descriptors with the Contiguous hint) whose granularity is 'granularity'.
+ * None of the regions that overlap the range can have asked for a finer
+ * granularity. Dynamic regions can be unmapped later on, so if one of them
+ * overlaps the range it must cover it completely.
+ */
+static bool xlat_range_is_mergeable(const xlat_ctx_t *ctx, uintptr_t base_va,
+				    uintptr_t end_va, size_t granularity)
+{
+	for (const mmap_region_t *mm = ctx->mmap; mm->size != 0U; ++mm) {
+		uintptr_t mm_end_va = mm->base_va + mm->size - 1U;
+
+		if ((mm_end_va < base_va) || (mm->base_va > end_va))
+			continue;
+
+		if (mm->granularity < granularity)
+			return false;
+
+#if PLAT_XLAT_TABLES_DYNAMIC
+		if (((mm->attr & MT_DYNAMIC) != 0U) &&
+		    ((mm->base_va > base_va) || (mm_end_va < end_va)))
+			return false;
+#endif /* PLAT_XLAT_TABLES_DYNAMIC */
+	}
+
+	return true;
+}
+
+/*
+ * Sets the Contiguous hint in every naturally aligned group of
+ * XLAT_CONT_ENTRIES descriptors of the given table that intersects the VA range
+ * [base_va, end_va] and can be merged. This lets the TLB cache the whole group
+ * in a single entry when a region can't be mapped with bigger blocks because of
+ * its size or alignment.
+ *
+ * The descriptors of a group must be either invalid before the region being
+ * mapped is written to them or not in use by the MMU, as they are modified
+ * without a break-before-make sequence.
+ */
+static void xlat_tables_set_cont_hint(const xlat_ctx_t *ctx,
+				      uintptr_t table_base_va,
+				      uint64_t *const table_base,
+				      unsigned int table_entries,
+				      unsigned int level,
+				      uintptr_t base_va, uintptr_t end_va)
+{
+	/* Only use the hint for 4 KiB pages and 2 MiB blocks. */
+	if (level < 2U)
+		return;
+
+	for (unsigned int idx = 0U; (idx + XLAT_CONT_ENTRIES) <= table_entries;
+	     idx += XLAT_CONT_ENTRIES) {
+		uintptr_t group_va = table_base_va +
+				     ((uintptr_t)idx * XLAT_BLOCK_SIZE(level));
+		uintptr_t group_end_va = group_va + XLAT_CONT_SIZE(level) - 1U;
+
+		if ((group_end_va < base_va) || (group_va > end_va))
+			continue;
+
+		if ((table_base[idx] & UPPER_ATTRS(CONT_HINT)) != 0ULL)
+			continue;
+
+		if (!xlat_entries_are_mergeable(&table_base[idx],
+				XLAT_CONT_ENTRIES, level, XLAT_CONT_SIZE(level)))
+			continue;
+
+		if (!xlat_range_is_mergeable(ctx, group_va, group_end_va,
+					     XLAT_BLOCK_SIZE(level - 1U)))
+			continue;
+
+		for (unsigned int i = 0U; i < XLAT_CONT_ENTRIES; i++)
+			table_base[idx + i] |= UPPER_ATTRS(CONT_HINT);
+	}
+}
+
 /*
  * Enumeration of actions that can be made when mapping table entries depending
  * on the previous value in that entry and information about the region being
@@ -369,6 +532,17 @@ static void xlat_tables_unmap_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 
 		if (action == ACTION_WRITE_BLOCK_ENTRY) {
 
+			/*
+			 * Don't leave the rest of the group marked as
+			 * contiguous once this entry is invalid. Dynamic
+			 * regions always cover their groups completely, so
+			 * this doesn't unmap memory of any other region.
+			 */
+			if ((desc & UPPER_ATTRS(CONT_HINT)) != 0ULL) {
+				xlat_clear_cont_hint(ctx, &table_base[table_idx],
+						     table_idx_va, level);
+			}
+
 			table_base[table_idx] = INVALID_DESC;
 			xlat_arch_tlbi_va(table_idx_va, ctx->xlat_regime);
 
@@ -644,9 +818,81 @@ static uintptr_t xlat_tables_map_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 			break;
 	}
 
+	xlat_tables_set_cont_hint(ctx, table_base_va, table_base,
+				  table_entries, level, mm->base_va, mm_end_va);
+
 	return table_idx_va - 1U;
 }
 
+/*
+ * Recursive function that replaces every subtable of the given table that maps
+ * a contiguous and aligned range of PAs with identical attributes by a single
+ * block descriptor. This happens when adjacent regions with the same attributes
+ * have been added, none of which could be mapped with blocks on its own.
+ *
+ * It must only be called before enabling the MMU, as descriptors are replaced
+ * without a break-before-make sequence.
+ */
+static void xlat_tables_fold(xlat_ctx_t *ctx, uintptr_t table_base_va,
+			     uint64_t *const table_base,
+			     unsigned int table_entries, unsigned int level)
+{
+	uintptr_t table_idx_va = table_base_va;
+
+	/* Level 3 tables only contain pages, there is nothing to fold. */
+	if (level == XLAT_TABLE_LEVEL_MAX)
+		return;
+
+	for (unsigned int table_idx = 0U; table_idx < table_entries;
+	     table_idx++, table_idx_va += XLAT_BLOCK_SIZE(level)) {
+		uint64_t desc = table_base[table_idx];
+		uint64_t *subtable;
+
+		if ((desc & DESC_MASK) != TABLE_DESC)
+			continue;
+
+		subtable = (uint64_t *)(uintptr_t)(desc & TABLE_ADDR_MASK);
+
+		/* Fold the finer levels first. */
+		xlat_tables_fold(ctx, table_idx_va, subtable,
+				 XLAT_TABLE_ENTRIES, level + 1U);
+
+		if (level < MIN_LVL_BLOCK_DESC)
+			continue;
+
+		if (!xlat_entries_are_mergeable(subtable, XLAT_TABLE_ENTRIES,
+				level + 1U, XLAT_BLOCK_SIZE(level)))
+			continue;
+
+		if (!xlat_range_is_mergeable(ctx, table_idx_va,
+				table_idx_va + XLAT_BLOCK_SIZE(level) - 1U,
+				XLAT_BLOCK_SIZE(level)))
+			continue;
+
+		/*
+		 * Block and page descriptors only differ in their type, so the
+		 * first descriptor of the subtable describes the whole block.
+		 */
+		table_base[table_idx] = (subtable[0] &
+			~(uint64_t)(DESC_MASK | UPPER_ATTRS(CONT_HINT))) |
+			BLOCK_DESC;
+
+#if PLAT_XLAT_TABLES_DYNAMIC
+		/* The subtable isn't referenced anymore, release it. */
+		ctx->tables_mapped_regions[xlat_table_get_index(ctx, subtable)] = 0;
+#endif
+	}
+
+	/* The new blocks may be grouped with the Contiguous hint. */
+	xlat_tables_set_cont_hint(ctx, table_base_va, table_base,
+				  table_entries, level, 0U, UINTPTR_MAX);
+
+#if !(HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
+	xlat_clean_dcache_range((uintptr_t)table_base,
+				table_entries * sizeof(uint64_t));
+#endif
+}
+
 /*
  * Function that verifies that a region can be mapped.
  * Returns:
@@ -1214,6 +1460,13 @@ void __init init_xlat_tables_ctx(xlat_ctx_t *ctx)
 		mm++;
 	}
 
+	/*
+	 * Now that all regions are mapped, use blocks for the subtables that
+	 * ended up describing a whole block with the same attributes.
+	 */
+	xlat_tables_fold(ctx, 0U, ctx->base_table, ctx->base_table_entries,
+			 ctx->base_level);
+
 	assert(ctx->pa_max_address <= xlat_arch_get_max_supported_pa());
 	assert(ctx->max_va <= ctx->va_max_address);
 	assert(ctx->max_pa <= ctx->pa_max_address);
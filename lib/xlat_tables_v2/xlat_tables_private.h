@@ -72,6 +72,14 @@ void xlat_mmap_print(const mmap_region_t *mmap);
  */
 void xlat_tables_print(xlat_ctx_t *ctx);
 
+/*
+ * Clears the Contiguous hint of the group of descriptors that contains the
+ * given block or page descriptor using a break-before-make sequence. The whole
+ * group is briefly unmapped while this happens.
+ */
+void xlat_clear_cont_hint(const xlat_ctx_t *ctx, uint64_t *entry,
+			  uintptr_t va, unsigned int level);
+
 /*
  * Returns a block/page table descriptor for the given level and attributes.
  */
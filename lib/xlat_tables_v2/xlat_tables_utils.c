@@ -95,6 +95,10 @@ static void xlat_desc_print(const xlat_ctx_t *ctx, uint64_t desc)
 
 	printf(((LOWER_ATTRS(NS) & desc) != 0ULL) ? "-NS" : "-S");
 
+	if ((desc & UPPER_ATTRS(CONT_HINT)) != 0ULL) {
+		printf("-CONT");
+	}
+
 #ifdef __aarch64__
 	/* Check Guarded Page bit */
 	if ((desc & GP) != 0ULL) {
@@ -113,13 +117,21 @@ static const char * const level_spacers[] = {
 static const char *invalid_descriptors_ommited =
 		"%s(%d invalid descriptors omitted)\n";
 
+/* Number of descriptors of each type found in the translation tables. */
+struct xlat_desc_stats {
+	unsigned int tables;
+	unsigned int blocks;
+	unsigned int pages;
+	unsigned int contiguous;
+};
+
 /*
  * Recursive function that reads the translation tables passed as an argument
  * and prints their status.
  */
 static void xlat_tables_print_internal(xlat_ctx_t *ctx, uintptr_t table_base_va,
 		const uint64_t *table_base, unsigned int table_entries,
-		unsigned int level)
+		unsigned int level, struct xlat_desc_stats *stats)
 {
 	assert(level <= XLAT_TABLE_LEVEL_MAX);
 
@@ -177,10 +189,21 @@ static void xlat_tables_print_internal(xlat_ctx_t *ctx, uintptr_t table_base_va,
 
 				uintptr_t addr_inner = desc & TABLE_ADDR_MASK;
 
+				stats->tables++;
 				xlat_tables_print_internal(ctx, table_idx_va,
 					(uint64_t *)addr_inner,
-					XLAT_TABLE_ENTRIES, level + 1U);
+					XLAT_TABLE_ENTRIES, level + 1U, stats);
 			} else {
+				if (level == XLAT_TABLE_LEVEL_MAX) {
+					stats->pages++;
+				} else {
+					stats->blocks++;
+				}
+
+				if ((desc & UPPER_ATTRS(CONT_HINT)) != 0ULL) {
+					stats->contiguous++;
+				}
+
 				printf("%sVA:0x%lx PA:0x%llx size:0x%zx ",
 				       level_spacers[level], table_idx_va,
 				       (uint64_t)(desc & TABLE_ADDR_MASK),
@@ -204,6 +227,7 @@ void xlat_tables_print(xlat_ctx_t *ctx)
 {
 	const char *xlat_regime_str;
 	int used_page_tables;
+	struct xlat_desc_stats stats = { 0U };
 
 	if (ctx->xlat_regime == EL1_EL0_REGIME) {
 		xlat_regime_str = "1&0";
@@ -238,7 +262,11 @@ void xlat_tables_print(xlat_ctx_t *ctx)
 		ctx->tables_num - used_page_tables);
 
 	xlat_tables_print_internal(ctx, 0U, ctx->base_table,
-				   ctx->base_table_entries, ctx->base_level);
+				   ctx->base_table_entries, ctx->base_level,
+				   &stats);
+
+	VERBOSE("  Descriptors: %u table, %u block, %u page (%u contiguous)\n",
+		stats.tables, stats.blocks, stats.pages, stats.contiguous);
 }
 
 #endif /* LOG_LEVEL >= LOG_LEVEL_VERBOSE */
@@ -424,6 +452,20 @@ int xlat_get_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 				NULL, NULL, NULL);
 }
 
+int xlat_get_desc_ctx(const xlat_ctx_t *ctx, uintptr_t base_va, uint64_t *desc)
+{
+	uint64_t *entry;
+	uint32_t attr;
+	int rc;
+
+	rc = xlat_get_mem_attributes_internal(ctx, base_va, &attr, &entry,
+					      NULL, NULL);
+	if (rc == 0) {
+		*desc = *entry;
+	}
+
+	return rc;
+}
 
 int xlat_change_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 				   size_t size, uint32_t attr)
@@ -528,6 +570,10 @@ int xlat_change_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 		(void) xlat_get_mem_attributes_internal(ctx, base_va, &old_attr,
 					    &entry, &addr_pa, &level);
 
+		if ((*entry & UPPER_ATTRS(CONT_HINT)) != 0ULL) {
+			xlat_clear_cont_hint(ctx, entry, base_va, level);
+		}
+
 		/*
 		 * From attr, only MT_RO/MT_RW, MT_EXECUTE/MT_EXECUTE_NEVER and
 		 * MT_USER/MT_PRIVILEGED are taken into account. Any other
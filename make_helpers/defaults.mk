@@ -43,6 +43,20 @@ NEW_TEST_SESSION	:= 1
 # Use non volatile memory for storing results
 USE_NVM			:= 0
 
+# Use the FEAT_MOPS instructions in memcpy() and memset() when they are
+# implemented by the PE
+USE_MOPS_MEMFUNCS	:= 0
+
+# Use interrupt-driven transmission for the PL011 console in TFTF
+PL011_TX_IRQ		:= 0
+
+# Build the GICv3 ITS driver into TFTF
+GICV3_ITS		:= 0
+
+# Use the architected timer of each CPU for the TFTF timer framework instead of
+# a timer shared by all CPUs
+PER_CPU_TIMER		:= 0
+
 # Build verbosity
 V			:= 0
 
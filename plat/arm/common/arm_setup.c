@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -34,6 +34,11 @@ void arm_platform_setup(void)
 
 	arm_gic_setup_global();
 	arm_gic_setup_local();
+
+#if defined(IMAGE_TFTF) && PL011_TX_IRQ
+	if (console_pl011_irq_init(PLAT_ARM_UART_BASE, PLAT_ARM_UART_IRQ) != 0)
+		WARN("Failed to enable interrupt-driven console output\n");
+#endif
 }
 
 void tftf_platform_setup(void)
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <drivers/arm/gic_v5.h>
+#include <drivers/arm/private_timer.h>
 #include <drivers/arm/system_timer.h>
 #include <platform.h>
 #include <stddef.h>
@@ -13,8 +14,38 @@
 
 #pragma weak plat_initialise_timer_ops
 
+#if PER_CPU_TIMER
+/* Use the EL1 physical timer of each CPU */
+static plat_timer_t plat_timers = {
+	.program = arm_gen_timer_program,
+	.program_deadline = arm_gen_timer_program_deadline,
+	.cancel = arm_gen_timer_cancel,
+	.handler = arm_gen_timer_handler,
+	.timer_step_value = 1,
+	.per_cpu = true,
+};
+
+int plat_initialise_timer_ops(const plat_timer_t **timer_ops)
+{
+	assert(timer_ops != NULL);
+	*timer_ops = &plat_timers;
+
+	/* PPIs are numbered from 0 on GICv5 and from 16 on GICv2/3 */
+	if (arm_gic_get_version() != 5) {
+		plat_timers.timer_irq = IRQ_PCPU_NS_TIMER;
+	} else {
+		plat_timers.timer_irq = (IRQ_PCPU_NS_TIMER - 16) | INPLACE(INT_TYPE, INT_PPI);
+	}
+
+	/* Initialise the generic timer */
+	arm_gen_timer_init();
+
+	return 0;
+}
+#else
 static plat_timer_t plat_timers = {
 	.program = program_systimer,
+	.program_deadline = program_systimer_deadline,
 	.cancel = cancel_systimer,
 	.handler = handler_systimer,
 	.timer_step_value = 2,
@@ -44,3 +75,4 @@ int plat_initialise_timer_ops(const plat_timer_t **timer_ops)
 
 	return 0;
 }
+#endif /* PER_CPU_TIMER */
@@ -71,6 +71,7 @@
 #define GICD_BASE		0x2f000000
 #define GICR_BASE		0x2f100000
 #define GICC_BASE		0x2c000000
+#define GITS_BASE		0x2f020000
 
 /*******************************************************************************
  * GICv5 related constants
@@ -92,6 +93,7 @@
 
 #define PLAT_ARM_UART_BASE		PL011_UART0_BASE
 #define PLAT_ARM_UART_CLK_IN_HZ		PL011_UART0_CLK_IN_HZ
+#define PLAT_ARM_UART_IRQ		37
 
 #define PLAT_ARM_SMC_FUZZER_UART_BASE		PL011_UART3_BASE
 #define PLAT_ARM_SMC_FUZZER_UART_CLK_IN_HZ	PL011_UART3_CLK_IN_HZ
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -289,6 +289,13 @@
 /* Per-CPU Non-Secure Timer Interrupt ID */
 #define IRQ_PCPU_NS_TIMER		30
 
+/*
+ * GICv3 ITS, and DeviceID the ITS sees for the writes of the CPUs to its
+ * GITS_TRANSLATER register.
+ */
+#define PLAT_ARM_GITS_BASE		GITS_BASE
+#define PLAT_ARM_GITS_CPU_DEVICE_ID	0
+
 
 /* Times(in ms) used by test code for completion of different events */
 #define PLAT_SUSPEND_ENTRY_TIME		15
@@ -12,6 +12,7 @@
 
 static const plat_timer_t plat_timers = {
 	.program = arm_gen_timer_program,
+	.program_deadline = arm_gen_timer_program_deadline,
 	.cancel = arm_gen_timer_cancel,
 	.handler = arm_gen_timer_handler,
 	.timer_step_value = 2,
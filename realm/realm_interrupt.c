@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -18,11 +18,14 @@ volatile bool pmu_isr_received;
 #define EL1_VIRT_TIMER_IRQ	27U
 
 /* External function to handle timer interrupt */
-extern void realm_handle_timer_interrupt(void);
+extern void realm_handle_timer_interrupt(uint64_t entry_cnt);
 
 /* Realm interrupt handler */
 void realm_interrupt_handler(void)
 {
+	/* Sample the virtual counter before anything else, for latency. */
+	uint64_t entry_cnt = virtualcounter_read();
+
 	/* Read INTID and acknowledge interrupt */
 	unsigned long iar1_el1 = read_icv_iar1_el1();
 
@@ -42,7 +45,7 @@ void realm_interrupt_handler(void)
 		isb();
 	} else if (iar1_el1 == EL1_VIRT_TIMER_IRQ) {
 		/* Handle timer interrupt */
-		realm_handle_timer_interrupt();
+		realm_handle_timer_interrupt(entry_cnt);
 	} else {
 		panic();
 	}
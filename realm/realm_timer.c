@@ -14,6 +14,9 @@
 /* Timer interrupt flag */
 static volatile bool timer_irq_received;
 
+/* Virtual counter value on entry to the timer interrupt handler */
+static volatile uint64_t timer_irq_entry_cnt;
+
 /* Convert milliseconds to timer ticks */
 static uint32_t ms_to_ticks(uint64_t ms)
 {
@@ -28,8 +31,9 @@ bool test_realm_el1_timer(void)
 {
 	u_register_t deadline_ms, wait_time_ms;
 	u_register_t start_time, end_time, elapsed_ms;
-	u_register_t ticks;
+	u_register_t ticks, latency_ticks = 0U;
 	u_register_t priority_bits, priority;
+	uint64_t deadline_cnt;
 
 	/* Get timer parameters from host */
 	deadline_ms = realm_shared_data_get_my_host_val(HOST_ARG1_INDEX);
@@ -63,6 +67,7 @@ bool test_realm_el1_timer(void)
 	/* Program the timer with the deadline */
 	ticks = ms_to_ticks(deadline_ms);
 	write_cntv_tval_el0(ticks);
+	deadline_cnt = read_cntv_cval_el0();
 
 	/* Record start time */
 	start_time = read_cntpct_el0();
@@ -87,22 +92,35 @@ bool test_realm_el1_timer(void)
 	/* Disable IRQ */
 	disable_irq();
 
-	realm_printf("Timer elapsed: %lums, interrupt received: %d\n",
-		elapsed_ms, timer_irq_received);
+	/*
+	 * The interrupt is raised when the virtual counter reaches the
+	 * deadline, the difference with the handler entry is the end-to-end
+	 * delivery latency through RMM and the Host.
+	 */
+	if (timer_irq_received) {
+		latency_ticks = timer_irq_entry_cnt - deadline_cnt;
+	}
+
+	realm_printf("Timer elapsed: %lums, interrupt received: %d, latency: %lu ticks\n",
+		elapsed_ms, timer_irq_received, latency_ticks);
 
 	/* Report results to host */
 	realm_shared_data_set_my_realm_val(HOST_ARG1_INDEX,
 		timer_irq_received ? 1UL : 0UL);
 	realm_shared_data_set_my_realm_val(HOST_ARG2_INDEX, elapsed_ms);
+	realm_shared_data_set_my_realm_val(HOST_ARG3_INDEX, latency_ticks);
 
 	return timer_irq_received;
 }
 
 /*
- * Handle EL1 virtual timer interrupt in realm.
+ * Handle EL1 virtual timer interrupt in realm. 'entry_cnt' is the virtual
+ * counter value sampled on entry to the interrupt handler.
  */
-void realm_handle_timer_interrupt(void)
+void realm_handle_timer_interrupt(uint64_t entry_cnt)
 {
+	timer_irq_entry_cnt = entry_cnt;
+
 	/* Set the flag to indicate interrupt received */
 	timer_irq_received = true;
 
@@ -1,9 +1,10 @@
 /*
- * Copyright (c) 2021-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <arch_helpers.h>
 #include <debug.h>
 
 #include "cactus_message_loop.h"
@@ -27,6 +28,12 @@ static uint32_t managed_exit_interrupt_id;
 /* Secure virtual interrupt that was last handled by Cactus SP. */
 uint32_t last_serviced_interrupt[PLATFORM_CORE_COUNT];
 
+/*
+ * System counter value sampled on entry to the handler of the last serviced
+ * interrupt, before it is even acknowledged.
+ */
+uint64_t last_serviced_interrupt_cnt[PLATFORM_CORE_COUNT];
+
 extern spinlock_t sp_handler_lock[NUM_VINT_ID];
 
 /*
@@ -110,10 +117,12 @@ void register_maintenance_interrupt_handlers(void)
 
 void cactus_interrupt_handler_irq(void)
 {
+	uint64_t entry_cnt = syscounter_read();
 	uint32_t intid = spm_interrupt_get();
 	unsigned int core_pos = spm_get_my_core_pos();
 
 	last_serviced_interrupt[core_pos] = intid;
+	last_serviced_interrupt_cnt[core_pos] = entry_cnt;
 
 	/* Invoke the handler registered by the SP. */
 	spin_lock(&sp_handler_lock[intid]);
@@ -128,10 +137,12 @@ void cactus_interrupt_handler_irq(void)
 
 void cactus_interrupt_handler_fiq(void)
 {
+	uint64_t entry_cnt = syscounter_read();
 	uint32_t intid = spm_interrupt_get();
 	unsigned int core_pos = spm_get_my_core_pos();
 
 	last_serviced_interrupt[core_pos] = intid;
+	last_serviced_interrupt_cnt[core_pos] = entry_cnt;
 
 	if (intid == MANAGED_EXIT_INTERRUPT_ID) {
 		/*
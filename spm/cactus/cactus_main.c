@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -308,6 +308,7 @@ void __dead2 cactus_main(bool primary_cold_boot,
 
 		mb.send = (void *) get_sp_tx_start(ffa_id);
 		mb.recv = (void *) get_sp_rx_start(ffa_id);
+		mb.size = SP_RX_TX_SIZE / 2;
 
 		/* Configure and enable Stage-1 MMU, enable D-Cache */
 		cactus_plat_configure_mmu(ffa_id);
@@ -315,6 +316,9 @@ void __dead2 cactus_main(bool primary_cold_boot,
 		/* Initialize locks for tail end interrupt handler */
 		sp_handler_spin_lock_init();
 
+		/* Index the command handlers for the message loop */
+		cactus_cmd_table_init();
+
 		if (boot_info_header != NULL) {
 			cactus_map_boot_info(boot_info_header, ffa_id == SP_ID(3));
 		}
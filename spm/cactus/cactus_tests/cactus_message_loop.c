@@ -1,9 +1,11 @@
 /*
- * Copyright (c) 2021-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <arch_helpers.h>
+#include <assert.h>
 #include <debug.h>
 
 #include <cactus_message_loop.h>
@@ -29,6 +31,106 @@ static uint32_t requests_counter[PLATFORM_CORE_COUNT];
 extern struct cactus_cmd_handler cactus_cmd_handler_begin[];
 extern struct cactus_cmd_handler cactus_cmd_handler_end[];
 
+/**
+ * Open addressing hash table of the command handlers, built at boot from the
+ * table above. Each slot holds the index of a handler plus one, or 0 if it is
+ * empty. The table is kept at most half full, so a lookup almost always takes
+ * a single probe.
+ */
+#define CMD_HASH_BITS		7U
+#define CMD_HASH_SIZE		(1U << CMD_HASH_BITS)
+#define CMD_MAX_HANDLERS	(CMD_HASH_SIZE / 2U)
+
+static uint8_t cmd_hash_table[CMD_HASH_SIZE];
+
+/**
+ * Statistics of each command handler, for each CPU. They can be accessed in
+ * the same way as 'requests_counter'.
+ */
+struct cactus_cmd_stats {
+	uint32_t count;
+	uint64_t total_ticks;
+	uint64_t max_ticks;
+};
+
+static struct cactus_cmd_stats cmd_stats[PLATFORM_CORE_COUNT][CMD_MAX_HANDLERS];
+
+/**
+ * Virtual counter values of the last command handled by each CPU, returned by
+ * CACTUS_GET_CMD_TIMING_CMD.
+ */
+struct cactus_cmd_timing {
+	uint64_t cmd;
+	uint64_t entry;
+	uint64_t handler;
+	uint64_t response;
+};
+
+static struct cactus_cmd_timing cmd_timing[PLATFORM_CORE_COUNT];
+
+/**
+ * Virtual counter value at which each CPU last sent a response.
+ */
+static uint64_t response_cnt[PLATFORM_CORE_COUNT];
+
+void cactus_cmd_mark_response(void)
+{
+	response_cnt[spm_get_my_core_pos()] = virtualcounter_read();
+}
+
+static unsigned int cmd_hash(uint64_t id)
+{
+	/* Fibonacci hashing, keeping the top bits of the product. */
+	return (unsigned int)((id * 0x9e3779b97f4a7c15ULL) >>
+			      (64U - CMD_HASH_BITS));
+}
+
+void cactus_cmd_table_init(void)
+{
+	unsigned int num_handlers = cactus_cmd_handler_end -
+				    cactus_cmd_handler_begin;
+
+	if (num_handlers > CMD_MAX_HANDLERS) {
+		ERROR("Too many Cactus command handlers (%u)\n", num_handlers);
+		panic();
+	}
+
+	for (unsigned int i = 0U; i < num_handlers; i++) {
+		uint64_t id = cactus_cmd_handler_begin[i].id;
+		unsigned int slot = cmd_hash(id);
+
+		while (cmd_hash_table[slot] != 0U) {
+			if (cactus_cmd_handler_begin[
+				cmd_hash_table[slot] - 1U].id == id) {
+				ERROR("Duplicate Cactus command %llx\n",
+				      (unsigned long long)id);
+				panic();
+			}
+			slot = (slot + 1U) & (CMD_HASH_SIZE - 1U);
+		}
+
+		cmd_hash_table[slot] = (uint8_t)(i + 1U);
+	}
+}
+
+/**
+ * Return the index of the handler of command 'id', or -1 if there is none.
+ */
+static int cactus_cmd_lookup(uint64_t id)
+{
+	unsigned int slot = cmd_hash(id);
+	unsigned int index;
+
+	while ((index = cmd_hash_table[slot]) != 0U) {
+		if (cactus_cmd_handler_begin[index - 1U].id == id) {
+			return (int)(index - 1U);
+		}
+		slot = (slot + 1U) & (CMD_HASH_SIZE - 1U);
+	}
+
+	return -1;
+}
+
 #define PRINT_CMD(smc_ret)						\
 	VERBOSE("cmd %lx; args: %lx, %lx, %lx, %lx\n",	 		\
 		smc_ret.arg3, smc_ret.arg4, smc_ret.arg5, 		\
@@ -38,13 +140,18 @@ extern struct cactus_cmd_handler cactus_cmd_handler_end[];
 ffa_id_t g_dir_req_source_id;
 
 /**
- * Traverses command table from section ".cactus_handler", searches for a
- * registered command and invokes the respective handler.
+ * Looks up a registered command in the table of command handlers, and invokes
+ * the respective handler.
  */
 bool cactus_handle_cmd(struct ffa_value *cmd_args, struct ffa_value *ret,
 		       struct mailbox_buffers *mb)
 {
+	uint64_t entry = virtualcounter_read();
 	uint64_t in_cmd;
+	uint64_t start, ticks;
+	struct cactus_cmd_stats *stats;
+	struct cactus_cmd_timing *timing;
+	int index;
 
 	/* Get vCPU index for currently running vCPU. */
 	unsigned int core_pos = spm_get_my_core_pos();
@@ -64,23 +171,47 @@ bool cactus_handle_cmd(struct ffa_value *cmd_args, struct ffa_value *ret,
 
 	in_cmd = cactus_get_cmd(*cmd_args);
 
-	for (struct cactus_cmd_handler *it_cmd = cactus_cmd_handler_begin;
-	     it_cmd < cactus_cmd_handler_end;
-	     it_cmd++) {
-		if (it_cmd->id == in_cmd) {
-			*ret = it_cmd->fn(cmd_args, mb);
-
-			/*
-			 * Increment the number of requests handled in current
-			 * core.
-			 */
-			requests_counter[core_pos]++;
-
-			return true;
+	index = cactus_cmd_lookup(in_cmd);
+	if (index >= 0) {
+		response_cnt[core_pos] = 0U;
+		start = virtualcounter_read();
+		*ret = cactus_cmd_handler_begin[index].fn(cmd_args, mb);
+
+		/*
+		 * The handler returns once the next request is received, so
+		 * its time is counted up to the response it sent.
+		 */
+		if (response_cnt[core_pos] == 0U) {
+			response_cnt[core_pos] = virtualcounter_read();
 		}
+		ticks = response_cnt[core_pos] - start;
+
+		timing = &cmd_timing[core_pos];
+		timing->cmd = in_cmd;
+		timing->entry = entry;
+		timing->handler = start;
+		timing->response = response_cnt[core_pos];
+
+		/*
+		 * Increment the number of requests handled in current
+		 * core, and account for the time spent in the handler.
+		 */
+		requests_counter[core_pos]++;
+
+		stats = &cmd_stats[core_pos][index];
+		stats->count++;
+		stats->total_ticks += ticks;
+		if (ticks > stats->max_ticks) {
+			stats->max_ticks = ticks;
+		}
+
+		return true;
 	}
 
-	/* Handle special command. */
+	/*
+	 * Handle special commands. They are not accounted for, so that they
+	 * don't disturb what they report.
+	 */
 	if (in_cmd == CACTUS_GET_REQ_COUNT_CMD) {
 		uint32_t requests_counter_resp;
 
@@ -96,6 +227,35 @@ bool cactus_handle_cmd(struct ffa_value *cmd_args, struct ffa_value *ret,
 		return true;
 	}
 
+	if (in_cmd == CACTUS_GET_CMD_STATS_CMD) {
+		index = cactus_cmd_lookup(
+				cactus_get_cmd_stats_cmd_id(*cmd_args));
+		if (index < 0) {
+			*ret = cactus_error_resp(ffa_dir_msg_dest(*cmd_args),
+						 ffa_dir_msg_source(*cmd_args),
+						 CACTUS_ERROR_INVALID);
+			return true;
+		}
+
+		stats = &cmd_stats[core_pos][index];
+		*ret = cactus_send_response(ffa_dir_msg_dest(*cmd_args),
+					    ffa_dir_msg_source(*cmd_args),
+					    CACTUS_SUCCESS, stats->count,
+					    stats->total_ticks,
+					    stats->max_ticks, 0);
+		return true;
+	}
+
+	if (in_cmd == CACTUS_GET_CMD_TIMING_CMD) {
+		timing = &cmd_timing[core_pos];
+		*ret = cactus_send_response(ffa_dir_msg_dest(*cmd_args),
+					    ffa_dir_msg_source(*cmd_args),
+					    CACTUS_SUCCESS, timing->cmd,
+					    timing->entry, timing->handler,
+					    timing->response);
+		return true;
+	}
+
 	*ret = cactus_error_resp(ffa_dir_msg_dest(*cmd_args),
 				 ffa_dir_msg_source(*cmd_args),
 				 CACTUS_ERROR_UNHANDLED);
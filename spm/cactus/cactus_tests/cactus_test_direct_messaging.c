@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -16,6 +16,15 @@ CACTUS_CMD_HANDLER(echo_cmd, CACTUS_ECHO_CMD)
 	VERBOSE("Received echo at %x, value %llx.\n", ffa_dir_msg_dest(*args),
 						      echo_val);
 
+	/* Answer with the calling convention of the request. */
+	if (ffa_func_id(*args) == FFA_MSG_SEND_DIRECT_REQ_SMC32) {
+		cactus_cmd_mark_response();
+		return ffa_msg_send_direct_resp32(ffa_dir_msg_dest(*args),
+						  ffa_dir_msg_source(*args),
+						  CACTUS_SUCCESS,
+						  (uint32_t)echo_val, 0, 0, 0);
+	}
+
 	return cactus_success_resp(ffa_dir_msg_dest(*args),
 				   ffa_dir_msg_source(*args),
 				   echo_val);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -11,6 +11,7 @@
 #include "utils_def.h"
 #include <ffa_endpoints.h>
 #include <spm_common.h>
+#include <string.h>
 
 CACTUS_CMD_HANDLER(req_msg_send, CACTUS_REQ_MSG_SEND_CMD)
 {
@@ -36,3 +37,50 @@ CACTUS_CMD_HANDLER(req_msg_send, CACTUS_REQ_MSG_SEND_CMD)
 
 	return cactus_success_resp(vm_id, source, 0);
 }
+
+CACTUS_CMD_HANDLER(ind_msg_recv, CACTUS_IND_MSG_RECV_CMD)
+{
+	/* Only used by the benchmark, from one vCPU at a time. */
+	static uint8_t payload_copy[FFA_PARTITION_MSG_PAYLOAD_MAX];
+	const ffa_id_t vm_id = ffa_dir_msg_dest(*args);
+	const ffa_id_t source = ffa_dir_msg_source(*args);
+	const bool in_place = cactus_ind_msg_recv_in_place(*args);
+	const uint8_t *payload;
+	ffa_id_t sender;
+	size_t size;
+	uint64_t sum = 0U;
+
+	payload = indirect_message_rx_borrow(mb->recv, vm_id, &sender, &size);
+	if (payload == NULL) {
+		ERROR("No valid indirect message to receive.\n");
+		return cactus_error_resp(vm_id, source, CACTUS_ERROR_TEST);
+	}
+
+	if (size > sizeof(payload_copy)) {
+		ERROR("Indirect message payload too large: %lu\n", size);
+		(void)indirect_message_rx_release(vm_id, vm_id);
+		return cactus_error_resp(vm_id, source, CACTUS_ERROR_TEST);
+	}
+
+	/* Free the RX buffer as early as possible when copying the payload. */
+	if (!in_place) {
+		memcpy(payload_copy, payload, size);
+		payload = payload_copy;
+
+		if (!indirect_message_rx_release(vm_id, vm_id)) {
+			return cactus_error_resp(vm_id, source,
+						 CACTUS_ERROR_FFA_CALL);
+		}
+	}
+
+	for (size_t i = 0U; i < size; i++) {
+		sum += payload[i];
+	}
+
+	if (in_place && !indirect_message_rx_release(vm_id, vm_id)) {
+		return cactus_error_resp(vm_id, source, CACTUS_ERROR_FFA_CALL);
+	}
+
+	return cactus_send_response(vm_id, source, CACTUS_SUCCESS, sum, size,
+				    sender, 0);
+}
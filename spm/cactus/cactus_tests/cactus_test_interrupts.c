@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -17,6 +17,8 @@
 
 /* Secure virtual interrupt that was last handled by Cactus SP. */
 extern uint32_t last_serviced_interrupt[PLATFORM_CORE_COUNT];
+extern uint64_t last_serviced_interrupt_cnt[PLATFORM_CORE_COUNT];
+extern uint64_t arch_timer_deadline[PLATFORM_CORE_COUNT];
 static int flag_set;
 static volatile bool test_espi_handled;
 
@@ -128,6 +130,36 @@ CACTUS_CMD_HANDLER(sleep_fwd_cmd, CACTUS_FWD_SLEEP_CMD)
 	return cactus_success_resp(vm_id, ffa_dir_msg_source(*args), 0);
 }
 
+CACTUS_CMD_HANDLER(yield_loop_cmd, CACTUS_YIELD_LOOP_CMD)
+{
+	ffa_id_t vm_id = ffa_dir_msg_dest(*args);
+	uint32_t run_ms = cactus_get_sleep_time(*args);
+	uint64_t timer_freq = read_cntfrq_el0();
+	uint64_t period = (cactus_get_yield_period(*args) * timer_freq) /
+			  1000000U;
+	uint64_t start = virtualcounter_read();
+	uint64_t last_yield = start;
+	uint64_t now = start;
+	uint32_t yields = 0U;
+	struct ffa_value ret;
+
+	VERBOSE("Request to run %x for %ums.\n", vm_id, run_ms);
+
+	while ((now - start) < ((run_ms * timer_freq) / 1000U)) {
+		if ((now - last_yield) >= period) {
+			/* Keep busy looping if the SPMC denies the yield. */
+			ret = ffa_yield();
+			if (!is_ffa_call_error(ret)) {
+				yields++;
+			}
+			last_yield = virtualcounter_read();
+		}
+		now = virtualcounter_read();
+	}
+
+	return cactus_success_resp(vm_id, ffa_dir_msg_source(*args), yields);
+}
+
 CACTUS_CMD_HANDLER(interrupt_cmd, CACTUS_INTERRUPT_CMD)
 {
 	uint32_t int_id = cactus_get_interrupt_id(*args);
@@ -231,6 +263,26 @@ CACTUS_CMD_HANDLER(interrupt_serviced_cmd, CACTUS_LAST_INTERRUPT_SERVICED_CMD)
 			       last_serviced_interrupt[core_pos]);
 }
 
+CACTUS_CMD_HANDLER(interrupt_latency_cmd, CACTUS_LAST_INTERRUPT_LATENCY_CMD)
+{
+	unsigned int core_pos = spm_get_my_core_pos();
+	uint32_t intid = last_serviced_interrupt[core_pos];
+	uint64_t raised_cnt = 0U;
+
+	/*
+	 * The time at which the interrupt was raised is only known for
+	 * interrupts the SP generates itself from a counter deadline.
+	 */
+	if (intid == TIMER_VIRTUAL_INTID) {
+		raised_cnt = arch_timer_deadline[core_pos];
+	}
+
+	return cactus_send_response(ffa_dir_msg_dest(*args),
+				    ffa_dir_msg_source(*args),
+				    CACTUS_SUCCESS, intid, raised_cnt,
+				    last_serviced_interrupt_cnt[core_pos], 0);
+}
+
 static void sec_interrupt_test_espi_handled(void)
 {
 	EXPECT(test_espi_handled, false);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,6 +12,7 @@
 #include <sp_helpers.h>
 #include "sp_tests.h"
 #include "spm_common.h"
+#include <spinlock.h>
 #include "stdint.h"
 #include <xlat_tables_defs.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
@@ -264,6 +265,100 @@ CACTUS_CMD_HANDLER(mem_send_cmd, CACTUS_MEM_SEND_CMD)
 				   source, data_abort_gpf_triggered);
 }
 
+/*
+ * The memory benchmark may send requests from several CPUs at the same time,
+ * serialise their use of the mailbox.
+ */
+static spinlock_t mem_perf_lock;
+
+CACTUS_CMD_HANDLER(mem_perf_cmd, CACTUS_MEM_PERF_CMD)
+{
+	ffa_id_t source = ffa_dir_msg_source(*args);
+	ffa_id_t vm_id = ffa_dir_msg_dest(*args);
+	uint32_t mem_func = cactus_req_mem_send_get_mem_func(*args);
+	ffa_memory_handle_t handle = cactus_mem_send_get_handle(*args);
+	uint64_t start, retrieve_ticks, relinquish_ticks = 0U;
+	uint32_t descriptor_size, total_size, offset;
+	uint32_t fragments = 1U;
+	struct ffa_value ret;
+	bool success = false;
+
+	struct ffa_memory_access receiver = ffa_memory_access_init(
+		vm_id, FFA_DATA_ACCESS_RW,
+		(mem_func == FFA_MEM_SHARE_SMC64)
+			? FFA_INSTRUCTION_ACCESS_NOT_SPECIFIED
+			: FFA_INSTRUCTION_ACCESS_NX,
+		0, NULL);
+
+	spin_lock(&mem_perf_lock);
+
+	start = syscounter_read();
+
+	descriptor_size = ffa_memory_retrieve_request_init(
+		mb->send, handle, source, &receiver, 1, 0, 0,
+		FFA_MEMORY_NORMAL_MEM, FFA_MEMORY_CACHE_WRITE_BACK,
+		FFA_MEMORY_INNER_SHAREABLE);
+
+	ret = ffa_mem_retrieve_req(descriptor_size, descriptor_size);
+	if (ffa_func_id(ret) != FFA_MEM_RETRIEVE_RESP) {
+		ERROR("Failed to retrieve memory: %s\n",
+		      ffa_error_name(ffa_error_code(ret)));
+		goto out;
+	}
+
+	/* Fetch the other fragments of the response, without parsing them. */
+	total_size = ret.arg1;
+	offset = ret.arg2;
+
+	while (offset < total_size) {
+		if (ffa_func_id(ffa_rx_release()) != FFA_SUCCESS_SMC32) {
+			ERROR("Failed to release buffer!\n");
+			goto out;
+		}
+
+		ret = ffa_mem_frag_rx(handle, offset);
+		if ((ffa_func_id(ret) != FFA_MEM_FRAG_TX) ||
+		    (ffa_mem_frag_tx_frag_size(ret) == 0U)) {
+			ERROR("Failed to retrieve fragment at offset %u\n",
+			      offset);
+			goto out;
+		}
+
+		offset += ffa_mem_frag_tx_frag_size(ret);
+		fragments++;
+	}
+
+	if (ffa_func_id(ffa_rx_release()) != FFA_SUCCESS_SMC32) {
+		ERROR("Failed to release buffer!\n");
+		goto out;
+	}
+
+	retrieve_ticks = syscounter_read() - start;
+
+	/* A donated region now belongs to the SP. */
+	if (mem_func != FFA_MEM_DONATE_SMC64) {
+		start = syscounter_read();
+		if (!memory_relinquish((struct ffa_mem_relinquish *)mb->send,
+				       handle, vm_id)) {
+			goto out;
+		}
+		relinquish_ticks = syscounter_read() - start;
+	}
+
+	success = true;
+
+out:
+	spin_unlock(&mem_perf_lock);
+
+	if (!success) {
+		return cactus_error_resp(vm_id, source, CACTUS_ERROR_FFA_CALL);
+	}
+
+	return cactus_send_response(vm_id, source, CACTUS_SUCCESS,
+				    retrieve_ticks, relinquish_ticks,
+				    fragments, 0);
+}
+
 CACTUS_CMD_HANDLER(req_mem_send_cmd, CACTUS_REQ_MEM_SEND_CMD)
 {
 	struct ffa_value ffa_ret;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,11 @@
 #include "debug.h"
 #include <spm_helpers.h>
 
+#include <platform_def.h>
+
+/* Counter value at which the arch timer was last programmed to fire. */
+uint64_t arch_timer_deadline[PLATFORM_CORE_COUNT];
+
 uint32_t ms_to_ticks(uint64_t ms)
 {
 	return ms * read_cntfrq_el0() / 1000;
@@ -27,6 +32,7 @@ CACTUS_CMD_HANDLER(set_virtual_timer, CACTUS_SET_ARCH_TIMER_CMD)
 	spm_interrupt_enable(TIMER_VIRTUAL_INTID, true, 0);
 
 	write_cntp_tval_el0(ticks);
+	arch_timer_deadline[spm_get_my_core_pos()] = read_cntp_cval_el0();
 	write_cntp_ctl_el0(1);
 
 	if (wait_time != 0U) {
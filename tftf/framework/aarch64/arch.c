@@ -8,6 +8,7 @@
 #include <arch_features.h>
 #include <arch_helpers.h>
 #include <arch_features.h>
+#include <string.h>
 #include <tftf_lib.h>
 
 void tftf_arch_setup(void)
@@ -57,5 +58,13 @@ void tftf_arch_setup(void)
 		if (is_armv8_2_sve_present()) {
 			tftf_smc_set_sve_hint(false);
 		}
+
+#if USE_MOPS_MEMFUNCS
+		/*
+		 * The FEAT_MOPS instructions can't be trapped at EL2, so they
+		 * can be used by memcpy() and memset() if implemented.
+		 */
+		memfuncs_init();
+#endif
 	}
 }
@@ -102,6 +102,17 @@ FRAMEWORK_SOURCES	+=						\
 	lib/extensions/sysreg128/aarch64/sysreg128_helpers.S
 endif
 
+ifeq (${PL011_TX_IRQ},1)
+ifneq (${ARCH},aarch64)
+        $(error "PL011_TX_IRQ is only supported on AArch64")
+endif
+FRAMEWORK_SOURCES	+=	drivers/arm/pl011/pl011_console_irq.c
+endif
+
+ifeq (${GICV3_ITS},1)
+FRAMEWORK_SOURCES	+=	drivers/arm/gic/gic_v3_its.c
+endif
+
 ifeq (${ARCH},aarch64)
 # Context Management Library support files
 FRAMEWORK_SOURCES	+=						\
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <arch.h>
 #include <arch_helpers.h>
+#include <assert.h>
 #include <debug.h>
 #include <drivers/arm/arm_gic.h>
 #include <errno.h>
@@ -15,6 +16,7 @@
 #include <platform_def.h>
 #include <power_management.h>
 #include <spinlock.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <tftf.h>
@@ -25,18 +27,58 @@
 #define TIMER_STEP_VALUE (plat_timer_info->timer_step_value)
 #define TIMER_IRQ (plat_timer_info->timer_irq)
 #define PROGRAM_TIMER(a) plat_timer_info->program(a)
+#define TIMER_PER_CPU (plat_timer_info->per_cpu)
 #define INVALID_CORE	UINT32_MAX
 #define INVALID_TIME	UINT64_MAX
 #define MAX_TIME_OUT_MS	10000
 
+/* Timer requests of all cores, TIMER_REQS_PER_CORE consecutive ones per core */
+#define TIMER_NUM_REQS		(PLATFORM_CORE_COUNT * TIMER_REQS_PER_CORE)
+#define REQ_INDEX(core, id)	(((core) * TIMER_REQS_PER_CORE) + (id))
+#define REQ_CORE(idx)		((idx) / TIMER_REQS_PER_CORE)
+/* Request made with tftf_program_timer() */
+#define PRIMARY_REQ_ID		0U
+
+/*
+ * The programmed interrupt isn't moved to an earlier request if it fires
+ * within this many microseconds, as it might already be on its way to the
+ * core it targets.
+ */
+#define TIMER_REPROGRAM_MARGIN_US	100U
+
 /*
  * Pointer containing available timer information for the platform.
  */
 static const plat_timer_t *plat_timer_info;
+
 /*
- * Interrupt requested time by cores in terms of absolute time.
+ * Interrupt requested time of each request in system counter ticks, or
+ * INVALID_TIME if the request isn't pending, and position of the request in
+ * the heap.
  */
-static volatile unsigned long long interrupt_req_time[PLATFORM_CORE_COUNT];
+static struct timer_req {
+	unsigned long long deadline;
+	unsigned int heap_pos;
+} timer_reqs[TIMER_NUM_REQS];
+
+/*
+ * Min-heap of the pending requests, ordered by deadline. The timer is
+ * programmed for the request at the top of the heap.
+ *
+ * With a shared timer, a single heap holds the requests of all cores and
+ * is protected by timer_lock. With a per-CPU timer, each core only handles
+ * its own requests, in its own heap.
+ */
+struct timer_heap {
+	unsigned int count;
+	unsigned int *nodes;
+};
+
+static unsigned int shared_heap_nodes[TIMER_NUM_REQS];
+static unsigned int cpu_heap_nodes[PLATFORM_CORE_COUNT][TIMER_REQS_PER_CORE];
+static struct timer_heap shared_heap;
+static struct timer_heap cpu_heaps[PLATFORM_CORE_COUNT];
+
 /*
  * Contains the target core number of the timer interrupt.
  */
@@ -55,17 +97,180 @@ static unsigned int systicks_per_ms;
  */
 static irq_handler_t timer_handler[PLATFORM_CORE_COUNT];
 
-/* Helper function */
-static inline unsigned long long get_current_time_ms(void)
+static inline unsigned long long us_to_ticks(unsigned long long micro_secs)
 {
 	assert(systicks_per_ms);
-	return syscounter_read() / systicks_per_ms;
+	return (micro_secs * systicks_per_ms) / 1000U;
 }
 
-static inline unsigned long long get_current_prog_time(void)
+static inline struct timer_heap *get_heap(unsigned int core_pos)
 {
-	return current_prog_core == INVALID_CORE ?
-		0 : interrupt_req_time[current_prog_core];
+	return TIMER_PER_CPU ? &cpu_heaps[core_pos] : &shared_heap;
+}
+
+static inline bool heap_less(unsigned int a, unsigned int b)
+{
+	/*
+	 * If 2 cores requested same value, give precedence
+	 * to the core with lowest core number
+	 */
+	if (timer_reqs[a].deadline != timer_reqs[b].deadline)
+		return timer_reqs[a].deadline < timer_reqs[b].deadline;
+
+	return a < b;
+}
+
+static void heap_set(struct timer_heap *heap, unsigned int pos,
+		     unsigned int idx)
+{
+	heap->nodes[pos] = idx;
+	timer_reqs[idx].heap_pos = pos;
+}
+
+static void heap_sift_up(struct timer_heap *heap, unsigned int pos)
+{
+	unsigned int idx = heap->nodes[pos];
+
+	while (pos > 0U) {
+		unsigned int parent = (pos - 1U) / 2U;
+
+		if (!heap_less(idx, heap->nodes[parent]))
+			break;
+
+		heap_set(heap, pos, heap->nodes[parent]);
+		pos = parent;
+	}
+
+	heap_set(heap, pos, idx);
+}
+
+static void heap_sift_down(struct timer_heap *heap, unsigned int pos)
+{
+	unsigned int idx = heap->nodes[pos];
+
+	for (;;) {
+		unsigned int child = (2U * pos) + 1U;
+
+		if (child >= heap->count)
+			break;
+
+		if (((child + 1U) < heap->count) &&
+		    heap_less(heap->nodes[child + 1U], heap->nodes[child]))
+			child++;
+
+		if (!heap_less(heap->nodes[child], idx))
+			break;
+
+		heap_set(heap, pos, heap->nodes[child]);
+		pos = child;
+	}
+
+	heap_set(heap, pos, idx);
+}
+
+static void heap_insert(struct timer_heap *heap, unsigned int idx)
+{
+	heap_set(heap, heap->count, idx);
+	heap->count++;
+	heap_sift_up(heap, heap->count - 1U);
+}
+
+static void heap_remove(struct timer_heap *heap, unsigned int idx)
+{
+	unsigned int pos = timer_reqs[idx].heap_pos;
+
+	assert((pos < heap->count) && (heap->nodes[pos] == idx));
+
+	heap->count--;
+	if (pos == heap->count)
+		return;
+
+	/* Move the last node into the hole and restore the heap property */
+	heap_set(heap, pos, heap->nodes[heap->count]);
+	heap_sift_up(heap, pos);
+	heap_sift_down(heap, timer_reqs[heap->nodes[pos]].heap_pos);
+}
+
+static inline unsigned int heap_top(const struct timer_heap *heap)
+{
+	return (heap->count == 0U) ? TIMER_NUM_REQS : heap->nodes[0];
+}
+
+/*
+ * Program the timer to fire at the deadline of request idx. Platforms which
+ * can only program a timeout get it rounded up to the next millisecond, so
+ * the interrupt never comes early.
+ */
+static int program_req(unsigned int idx)
+{
+	unsigned long long deadline = timer_reqs[idx].deadline;
+	unsigned long long now, time_out_ms;
+
+	if (plat_timer_info->program_deadline != NULL)
+		return plat_timer_info->program_deadline(deadline);
+
+	now = syscounter_read();
+	time_out_ms = (deadline > now) ?
+		(deadline - now + systicks_per_ms - 1U) / systicks_per_ms : 0U;
+
+	if (time_out_ms == 0U)
+		time_out_ms = 1U;
+
+	return PROGRAM_TIMER(time_out_ms);
+}
+
+/*
+ * Move the timer interrupt to the request at the top of the heap, or leave
+ * the timer stopped if there isn't any. With a shared timer, the caller must
+ * hold timer_lock.
+ */
+static int program_next_req(struct timer_heap *heap)
+{
+	unsigned int next = heap_top(heap);
+	int rc;
+
+	if (next == TIMER_NUM_REQS) {
+		if (!TIMER_PER_CPU)
+			current_prog_core = INVALID_CORE;
+		return 0;
+	}
+
+	if (!TIMER_PER_CPU) {
+		arm_gic_set_intr_target(TIMER_IRQ, REQ_CORE(next));
+		current_prog_core = REQ_CORE(next);
+	}
+
+	rc = program_req(next);
+	/* We don't expect timer programming to fail */
+	if (rc)
+		ERROR("%s %d: rc = %d\n", __func__, __LINE__, rc);
+
+	return rc;
+}
+
+/*
+ * Disable IRQs, so that the timer handler can't run on this core while it
+ * updates the requests, and take timer_lock if the timer is shared.
+ */
+static u_register_t timer_lock_get(void)
+{
+	u_register_t flags = read_daif();
+
+	disable_irq();
+	if (!TIMER_PER_CPU)
+		spin_lock(&timer_lock);
+
+	return flags;
+}
+
+static void timer_lock_release(u_register_t flags)
+{
+	if (!TIMER_PER_CPU)
+		spin_unlock(&timer_lock);
+
+	/* Restore DAIF flags */
+	write_daif(flags);
+	isb();
 }
 
 int tftf_initialise_timer(void)
@@ -80,10 +285,16 @@ int tftf_initialise_timer(void)
 
 	/* Systems can't support single tick as a step value */
 	assert(TIMER_STEP_VALUE);
+	/* A per-CPU timer must have a per-CPU interrupt */
+	assert(!TIMER_PER_CPU || !arm_gic_is_irq_shared(TIMER_IRQ));
 
-	/* Initialise the array to max possible time */
+	/* Initialise the requests to max possible time */
+	for (unsigned int i = 0; i < TIMER_NUM_REQS; i++)
+		timer_reqs[i].deadline = INVALID_TIME;
+
+	shared_heap.nodes = shared_heap_nodes;
 	for (unsigned int i = 0; i < PLATFORM_CORE_COUNT; i++)
-		interrupt_req_time[i] = INVALID_TIME;
+		cpu_heaps[i].nodes = cpu_heap_nodes[i];
 
 	tftf_irq_register_handler(TIMER_IRQ, tftf_timer_framework_handler);
 	arm_gic_set_intr_priority(TIMER_IRQ, GIC_HIGHEST_NS_PRIORITY);
@@ -97,6 +308,16 @@ int tftf_initialise_timer(void)
 
 void tftf_initialise_timer_secondary_core(void)
 {
+	if (TIMER_PER_CPU) {
+		/* The state of the timer of this CPU is unknown out of reset */
+		plat_timer_info->cancel();
+
+		/* PPI handlers are banked, register it for this CPU as well */
+		if (arm_gic_get_irq_desc(TIMER_IRQ)->handler == NULL)
+			tftf_irq_register_handler(TIMER_IRQ,
+						  tftf_timer_framework_handler);
+	}
+
 	if (!arm_gic_is_irq_shared(TIMER_IRQ)) {
 		arm_gic_set_intr_priority(TIMER_IRQ, GIC_HIGHEST_NS_PRIORITY);
 		arm_gic_intr_enable(TIMER_IRQ);
@@ -104,37 +325,137 @@ void tftf_initialise_timer_secondary_core(void)
 }
 
 /*
- * It returns the core number of next timer request to be serviced or
- * -1 if there is no request from any core. The next service request
- * is the core whose interrupt needs to be fired first.
+ * Add request 'id' of the calling core, to fire after 'delay' system counter
+ * ticks. If 'id' is TIMER_REQS_PER_CORE, any free request other than the
+ * primary one is used. The system counter value the request is due at is
+ * returned in 'deadline', if it is not NULL.
+ *
+ * Returns the identifier of the request, or -1 on failure.
  */
-static inline unsigned int get_lowest_req_core(void)
+static int timer_add_req(unsigned int id, unsigned long long delay,
+			 unsigned long long *deadline)
 {
-	unsigned long long lowest_timer = INVALID_TIME;
-	unsigned int lowest_core_req = INVALID_CORE;
-	unsigned int i;
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	struct timer_heap *heap = get_heap(core_pos);
+	unsigned long long now;
+	unsigned int idx, prev_top;
+	u_register_t flags;
+	int rc = 0;
+
+	flags = timer_lock_get();
+
+	if (id == TIMER_REQS_PER_CORE) {
+		for (id = PRIMARY_REQ_ID + 1U; id < TIMER_REQS_PER_CORE; id++) {
+			idx = REQ_INDEX(core_pos, id);
+			if (timer_reqs[idx].deadline == INVALID_TIME)
+				break;
+		}
+
+		if (id == TIMER_REQS_PER_CORE) {
+			timer_lock_release(flags);
+			ERROR("%s : No free timer request\n", __func__);
+			return -1;
+		}
+	}
+
+	idx = REQ_INDEX(core_pos, id);
+	/* A timer interrupt request is already available for the core */
+	assert(timer_reqs[idx].deadline == INVALID_TIME);
 
 	/*
-	 * If 2 cores requested same value, give precedence
-	 * to the core with lowest core number
+	 * Read time after acquiring timer_lock to account for any time taken
+	 * by lock contention.
 	 */
-	for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
-		if (interrupt_req_time[i] < lowest_timer) {
-			lowest_timer = interrupt_req_time[i];
-			lowest_core_req =  i;
-		}
+	now = syscounter_read();
+	timer_reqs[idx].deadline = now + delay;
+	if (deadline != NULL)
+		*deadline = timer_reqs[idx].deadline;
+
+	prev_top = heap_top(heap);
+	heap_insert(heap, idx);
+
+	VERBOSE("Need timer interrupt at: %llu current time: %llu\n",
+		timer_reqs[idx].deadline, now);
+
+	/*
+	 * If the request is the first one to fire, program the timer with it
+	 * and retarget the timer interrupt to the current core. A shared timer
+	 * which is about to fire for another core is left alone, the handler
+	 * will program this request afterwards.
+	 */
+	if ((heap_top(heap) == idx) &&
+	    (TIMER_PER_CPU || (prev_top == TIMER_NUM_REQS) ||
+	     (timer_reqs[prev_top].deadline >
+	      (now + us_to_ticks(TIMER_REPROGRAM_MARGIN_US))))) {
+		rc = program_next_req(heap);
 	}
 
-	return lowest_core_req;
+	timer_lock_release(flags);
+
+	return (rc == 0) ? (int)id : -1;
 }
 
-int tftf_program_timer(unsigned long time_out_ms)
+/*
+ * Cancel request 'id' of the calling core. Nothing is done if the request
+ * isn't pending.
+ */
+static int timer_cancel_req(unsigned int id)
 {
-	unsigned int core_pos;
-	unsigned long long current_time;
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	struct timer_heap *heap = get_heap(core_pos);
+	unsigned int idx = REQ_INDEX(core_pos, id);
 	u_register_t flags;
+	bool was_top;
 	int rc = 0;
 
+	/*
+	 * IRQ is disabled so that if a timer is fired after taking a lock,
+	 * it will remain pending and a core does not hit IRQ handler trying
+	 * to acquire an already locked spin_lock causing dead lock.
+	 */
+	flags = timer_lock_get();
+
+	if (timer_reqs[idx].deadline == INVALID_TIME)
+		goto exit;
+
+	was_top = (heap_top(heap) == idx);
+	heap_remove(heap, idx);
+	timer_reqs[idx].deadline = INVALID_TIME;
+
+	if (was_top) {
+		/*
+		 * Cancel the programmed interrupt at the peripheral. If the
+		 * timer interrupt is level triggered and fired this also
+		 * deactivates the pending interrupt.
+		 */
+		rc = plat_timer_info->cancel();
+		/* We don't expect cancel timer to fail */
+		if (rc) {
+			ERROR("%s %d: rc = %d\n", __func__, __LINE__, rc);
+			goto exit;
+		}
+
+		/*
+		 * For edge triggered interrupts, if an IRQ is fired before
+		 * cancel timer is executed, the signal remains pending. So,
+		 * clear the Timer IRQ if it is already pending.
+		 */
+		if (arm_gic_is_intr_pending(TIMER_IRQ))
+			arm_gic_intr_clear(TIMER_IRQ);
+
+		/* Program the timer for the next request, if any */
+		rc = program_next_req(heap);
+		VERBOSE("Cancelling timer : %u\n", core_pos);
+	}
+
+exit:
+	timer_lock_release(flags);
+
+	return rc;
+}
+
+int tftf_program_timer(unsigned long time_out_ms)
+{
 	/*
 	 * Some timer implementations have a very small max timeouts due to
 	 * this if a request is asked for greater than the max time supported
@@ -152,63 +473,49 @@ int tftf_program_timer(unsigned long time_out_ms)
 		time_out_ms = TIMER_STEP_VALUE;
 	}
 
-	core_pos = platform_get_core_pos(read_mpidr_el1());
-	/* A timer interrupt request is already available for the core */
-	assert(interrupt_req_time[core_pos] == INVALID_TIME);
-
-	flags = read_daif();
-	disable_irq();
-	spin_lock(&timer_lock);
-
-	assert((current_prog_core < PLATFORM_CORE_COUNT) ||
-		(current_prog_core == INVALID_CORE));
-
-	/*
-	 * Read time after acquiring timer_lock to account for any time taken
-	 * by lock contention.
-	 */
-	current_time = get_current_time_ms();
+	if (timer_add_req(PRIMARY_REQ_ID,
+			  (unsigned long long)time_out_ms * systicks_per_ms,
+			  NULL) < 0)
+		return -1;
 
-	/* Update the requested time */
-	interrupt_req_time[core_pos] = current_time + time_out_ms;
+	return 0;
+}
 
-	VERBOSE("Need timer interrupt at: %lld current_prog_time:%lld\n"
-			" current time: %lld\n", interrupt_req_time[core_pos],
-					get_current_prog_time(),
-					get_current_time_ms());
+int tftf_program_timer_us(unsigned long micro_secs)
+{
+	return tftf_program_timer_us_deadline(micro_secs, NULL);
+}
 
-	/*
-	 * If the interrupt request time is less than the current programmed
-	 * by timer_step_value or timer is not programmed. Program it with
-	 * requested time and retarget the timer interrupt to the current
-	 * core.
-	 */
-	if ((!get_current_prog_time()) || (interrupt_req_time[core_pos] <
-				(get_current_prog_time() - TIMER_STEP_VALUE))) {
+int tftf_program_timer_us_deadline(unsigned long micro_secs,
+				   unsigned long long *deadline)
+{
+	if ((micro_secs > (MAX_TIME_OUT_MS * 1000UL)) || (micro_secs == 0)) {
+		ERROR("%s : Greater than max timeout request\n", __func__);
+		return -1;
+	}
 
-		if (arm_gic_is_irq_shared(TIMER_IRQ)) {
-			arm_gic_set_intr_target(TIMER_IRQ, core_pos);
-		}
+	if (timer_add_req(PRIMARY_REQ_ID, us_to_ticks(micro_secs),
+			  deadline) < 0)
+		return -1;
 
-		rc = PROGRAM_TIMER(time_out_ms);
-		/* We don't expect timer programming to fail */
-		if (rc)
-			ERROR("%s %d: rc = %d\n", __func__, __LINE__, rc);
+	return 0;
+}
 
-		current_prog_core = core_pos;
+int tftf_timer_req_us(unsigned long micro_secs)
+{
+	if ((micro_secs > (MAX_TIME_OUT_MS * 1000UL)) || (micro_secs == 0)) {
+		ERROR("%s : Greater than max timeout request\n", __func__);
+		return -1;
 	}
 
-	spin_unlock(&timer_lock);
-	/* Restore DAIF flags */
-	write_daif(flags);
-	isb();
-
-	return rc;
+	return timer_add_req(TIMER_REQS_PER_CORE, us_to_ticks(micro_secs),
+			     NULL);
 }
 
-int tftf_program_timer_and_suspend(unsigned long milli_secs,
-				   unsigned int pwr_state,
-				   int *timer_rc, int *suspend_rc)
+static int program_timer_and_suspend(int (*program)(unsigned long),
+				     unsigned long time_out,
+				     unsigned int pwr_state,
+				     int *timer_rc, int *suspend_rc)
 {
 	int rc = 0;
 	u_register_t flags;
@@ -229,7 +536,7 @@ int tftf_program_timer_and_suspend(unsigned long milli_secs,
 	 * pending will prevent the CPU from entering suspend mode and not being
 	 * able to wake up.
 	 */
-	timer_rc_val = tftf_program_timer(milli_secs);
+	timer_rc_val = program(time_out);
 	if (timer_rc_val == 0) {
 		suspend_rc_val = tftf_cpu_suspend(pwr_state);
 		if (suspend_rc_val != PSCI_E_SUCCESS) {
@@ -259,6 +566,22 @@ int tftf_program_timer_and_suspend(unsigned long milli_secs,
 	return rc;
 }
 
+int tftf_program_timer_and_suspend(unsigned long milli_secs,
+				   unsigned int pwr_state,
+				   int *timer_rc, int *suspend_rc)
+{
+	return program_timer_and_suspend(tftf_program_timer, milli_secs,
+					 pwr_state, timer_rc, suspend_rc);
+}
+
+int tftf_program_timer_us_and_suspend(unsigned long micro_secs,
+				      unsigned int pwr_state,
+				      int *timer_rc, int *suspend_rc)
+{
+	return program_timer_and_suspend(tftf_program_timer_us, micro_secs,
+					 pwr_state, timer_rc, suspend_rc);
+}
+
 int tftf_program_timer_and_sys_suspend(unsigned long milli_secs,
 				   int *timer_rc, int *suspend_rc)
 {
@@ -269,6 +592,16 @@ int tftf_program_timer_and_sys_suspend(unsigned long milli_secs,
 	int timer_rc_val = 0;
 	int suspend_rc_val = PSCI_E_SUCCESS;
 
+	/* A per-CPU timer can't wake the system up */
+	if (TIMER_PER_CPU) {
+		ERROR("%s: not supported with a per-CPU timer\n", __func__);
+		if (timer_rc)
+			*timer_rc = -1;
+		if (suspend_rc)
+			*suspend_rc = suspend_rc_val;
+		return -1;
+	}
+
 	/* Preserve DAIF flags. IRQs need to be disabled for this to work. */
 	flags = read_daif();
 	disable_irq();
@@ -333,101 +666,35 @@ int tftf_timer_sleep(unsigned long milli_secs)
 
 int tftf_cancel_timer(void)
 {
-	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
-	unsigned int next_timer_req_core_pos;
-	unsigned long long current_time;
-	u_register_t flags;
-	int rc = 0;
-
-	/*
-	 * IRQ is disabled so that if a timer is fired after taking a lock,
-	 * it will remain pending and a core does not hit IRQ handler trying
-	 * to acquire an already locked spin_lock causing dead lock.
-	 */
-	flags = read_daif();
-	disable_irq();
-	spin_lock(&timer_lock);
-
-	interrupt_req_time[core_pos] = INVALID_TIME;
-
-	if (core_pos == current_prog_core) {
-		/*
-		 * Cancel the programmed interrupt at the peripheral. If the
-		 * timer interrupt is level triggered and fired this also
-		 * deactivates the pending interrupt.
-		 */
-		rc = plat_timer_info->cancel();
-		/* We don't expect cancel timer to fail */
-		if (rc) {
-			ERROR("%s %d: rc = %d\n", __func__, __LINE__, rc);
-			goto exit;
-		}
-
-		/*
-		 * For edge triggered interrupts, if an IRQ is fired before
-		 * cancel timer is executed, the signal remains pending. So,
-		 * clear the Timer IRQ if it is already pending.
-		 */
-		if (arm_gic_is_intr_pending(TIMER_IRQ))
-			arm_gic_intr_clear(TIMER_IRQ);
+	return timer_cancel_req(PRIMARY_REQ_ID);
+}
 
-		/* Get next timer consumer */
-		next_timer_req_core_pos = get_lowest_req_core();
-		if (next_timer_req_core_pos != INVALID_CORE) {
-
-			/* Retarget to the next_timer_req_core_pos */
-			arm_gic_set_intr_target(TIMER_IRQ, next_timer_req_core_pos);
-			current_prog_core = next_timer_req_core_pos;
-
-			current_time = get_current_time_ms();
-
-			/*
-			 * If the next timer request is lesser than or in a
-			 * window of TIMER_STEP_VALUE from current time,
-			 * program it to fire after TIMER_STEP_VALUE.
-			 */
-			if (interrupt_req_time[next_timer_req_core_pos] >
-					 current_time + TIMER_STEP_VALUE)
-				rc = PROGRAM_TIMER(interrupt_req_time[next_timer_req_core_pos] - current_time);
-			else
-				rc = PROGRAM_TIMER(TIMER_STEP_VALUE);
-			VERBOSE("Cancel and program new timer for core_pos: "
-						"%d %lld\n",
-						next_timer_req_core_pos,
-						get_current_prog_time());
-			/* We don't expect timer programming to fail */
-			if (rc)
-				ERROR("%s %d: rc = %d\n", __func__, __LINE__, rc);
-		} else {
-			current_prog_core = INVALID_CORE;
-			VERBOSE("Cancelling timer : %d\n", core_pos);
-		}
+int tftf_cancel_timer_req(int req_id)
+{
+	if ((req_id <= (int)PRIMARY_REQ_ID) || (req_id >= TIMER_REQS_PER_CORE)) {
+		ERROR("%s : Invalid timer request %d\n", __func__, req_id);
+		return -1;
 	}
-exit:
-	spin_unlock(&timer_lock);
-
-	/* Restore DAIF flags */
-	write_daif(flags);
-	isb();
 
-	return rc;
+	return timer_cancel_req((unsigned int)req_id);
 }
 
 int tftf_timer_framework_handler(void *data)
 {
 	unsigned int handler_core_pos = platform_get_core_pos(read_mpidr_el1());
-	unsigned int next_timer_req_core_pos;
+	struct timer_heap *heap = get_heap(handler_core_pos);
+	bool sgi_targets[PLATFORM_CORE_COUNT] = { false };
+	bool local_req = false, remote_req = false;
 	unsigned long long current_time;
-	int rc = 0;
+	unsigned int idx, core_pos;
+	int rc;
 
-	assert(interrupt_req_time[handler_core_pos] != INVALID_TIME);
-	spin_lock(&timer_lock);
-
-	current_time = get_current_time_ms();
-	/* Check if we interrupt is targeted correctly */
-	assert(handler_core_pos == current_prog_core);
+	if (!TIMER_PER_CPU) {
+		spin_lock(&timer_lock);
 
-	interrupt_req_time[handler_core_pos] = INVALID_TIME;
+		/* Check if we interrupt is targeted correctly */
+		assert(handler_core_pos == current_prog_core);
+	}
 
 	/* Execute the driver handler */
 	if (plat_timer_info->handler)
@@ -443,36 +710,41 @@ int tftf_timer_framework_handler(void *data)
 		panic();
 	}
 
+	current_time = syscounter_read();
+
+	/*
+	 * Retire all the requests whose time has come and send interrupts to
+	 * the CPUs they belong to. Requests are never retired early.
+	 */
+	for (idx = heap_top(heap); (idx != TIMER_NUM_REQS) &&
+	     (timer_reqs[idx].deadline <= current_time); idx = heap_top(heap)) {
+		heap_remove(heap, idx);
+		timer_reqs[idx].deadline = INVALID_TIME;
+
+		core_pos = REQ_CORE(idx);
+		if (core_pos == handler_core_pos) {
+			local_req = true;
+		} else {
+			sgi_targets[core_pos] = true;
+			remote_req = true;
+		}
+	}
+
+	if (remote_req)
+		tftf_send_sgi_multicast(IRQ_WAKE_SGI, sgi_targets);
+
 	/*
 	 * Execute the handler requested by the core, the handlers for the
 	 * other cores will be executed as part of handling IRQ_WAKE_SGI.
 	 */
-	if (timer_handler[handler_core_pos])
+	if (local_req && timer_handler[handler_core_pos])
 		timer_handler[handler_core_pos](data);
 
-	/* Send interrupts to all the CPUS in the min time block */
-	for (int i = 0; i < PLATFORM_CORE_COUNT; i++) {
-		if ((interrupt_req_time[i] <=
-				(current_time + TIMER_STEP_VALUE))) {
-			interrupt_req_time[i] = INVALID_TIME;
-			tftf_send_sgi(IRQ_WAKE_SGI, i);
-		}
-	}
-
-	/* Get the next lowest requested timer core and program it */
-	next_timer_req_core_pos = get_lowest_req_core();
-	if (next_timer_req_core_pos != INVALID_CORE) {
-		/* Check we have not exceeded the time for next core */
-		assert(interrupt_req_time[next_timer_req_core_pos] >
-							current_time);
-		arm_gic_set_intr_target(TIMER_IRQ, next_timer_req_core_pos);
-		rc = PROGRAM_TIMER(interrupt_req_time[next_timer_req_core_pos]
-				 - current_time);
-	}
-	/* Update current program core to the newer one */
-	current_prog_core = next_timer_req_core_pos;
+	/* Program the timer for the next request, if any */
+	rc = program_next_req(heap);
 
-	spin_unlock(&timer_lock);
+	if (!TIMER_PER_CPU)
+		spin_unlock(&timer_lock);
 
 	return rc;
 }
@@ -529,6 +801,20 @@ unsigned int tftf_get_timer_step_value(void)
 	return TIMER_STEP_VALUE;
 }
 
+bool tftf_timer_is_per_cpu(void)
+{
+	assert(plat_timer_info != NULL);
+
+	return TIMER_PER_CPU;
+}
+
+bool tftf_timer_has_us_resolution(void)
+{
+	assert(plat_timer_info != NULL);
+
+	return plat_timer_info->program_deadline != NULL;
+}
+
 /*
  * There are 4 cases that could happen when a system is resuming from system
  * suspend. The cases are:
@@ -537,15 +823,14 @@ unsigned int tftf_get_timer_step_value(void)
  * interrupt to our core and set the appropriate priority and enable it.
  *
  * 2. The resumed core was the last core to power down but the timer interrupt
- * is targeted to another core because of timer request grouping within
- * TIMER_STEP_VALUE. In this case, re-target the interrupt to our core
+ * is targeted to another core whose request was about to expire when ours was
+ * programmed. In this case, re-target the interrupt to our core
  * and set the appropriate priority and enable it
  *
  * 3. The system suspend request was down-graded by firmware and the timer
  * interrupt is targeted to another core which woke up first. In this case,
- * that core will wake us up and the interrupt_req_time[] corresponding to
- * our core will be cleared. In this case, no need to do anything as GIC
- * state is preserved.
+ * that core will wake us up and the requests of our core will be retired.
+ * In this case, no need to do anything as GIC state is preserved.
  *
  * 4. The system suspend is woken up by another external interrupt other
  * than the timer framework interrupt. In this case, just enable the
@@ -554,13 +839,28 @@ unsigned int tftf_get_timer_step_value(void)
 void tftf_timer_gic_state_restore(void)
 {
 	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	unsigned int id;
+
+	if (TIMER_PER_CPU) {
+		/* The interrupt is private to this CPU, there is no target. */
+		arm_gic_set_intr_priority(TIMER_IRQ, GIC_HIGHEST_NS_PRIORITY);
+		arm_gic_intr_enable(TIMER_IRQ);
+		return;
+	}
+
 	spin_lock(&timer_lock);
 
 	arm_gic_set_intr_priority(TIMER_IRQ, GIC_HIGHEST_NS_PRIORITY);
 	arm_gic_intr_enable(TIMER_IRQ);
 
-	/* Check if the programmed core is the woken up core */
-	if (interrupt_req_time[core_pos] == INVALID_TIME) {
+	/* Check if the woken up core has a pending request */
+	for (id = PRIMARY_REQ_ID; id < TIMER_REQS_PER_CORE; id++) {
+		if (timer_reqs[REQ_INDEX(core_pos, id)].deadline !=
+		    INVALID_TIME)
+			break;
+	}
+
+	if (id == TIMER_REQS_PER_CORE) {
 		INFO("The programmed core is not the one woken up\n");
 	} else {
 		current_prog_core = core_pos;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -40,6 +40,24 @@ static spinlock_t irq_handler_lock;
 /* Variable to confirm all cores are inside the testcase */
 static volatile unsigned int all_cores_inside_test;
 
+/* Number of timer requests made by each CPU in the per-CPU timer test */
+#define PER_CPU_TIMER_ROUNDS	10U
+/* Number of timer interrupts received by each CPU in the current round */
+static volatile unsigned int timer_irq_count[PLATFORM_CORE_COUNT];
+/* Interrupt ID and time of the last timer interrupt received by each CPU */
+static volatile unsigned int timer_irq_id[PLATFORM_CORE_COUNT];
+static volatile unsigned long long timer_irq_time[PLATFORM_CORE_COUNT];
+
+/*
+ * Maximum delay between the deadline of a request and the handling of its
+ * interrupt in the timer request tests.
+ */
+#define TIMER_MAX_LATENCY_US	500U
+/* Number of timer interrupts received in the timer request tests */
+static volatile unsigned int timer_records;
+/* Time at which each of these interrupts was received */
+static volatile unsigned long long timer_record_time[TIMER_REQS_PER_CORE];
+
 /*
  * Used by test cases to confirm if the programmed timer is fired. It also
  * keeps track of how many timer irq's are received.
@@ -410,6 +428,439 @@ test_result_t test_timer_target_multiple_same_interval(void)
 	return multiple_timer_count ? TEST_RESULT_SUCCESS : TEST_RESULT_SKIPPED;
 }
 
+static int per_cpu_timer_handler(void *data)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	timer_irq_time[core_pos] = syscounter_read();
+	timer_irq_id[core_pos] = *(unsigned int *)data;
+	timer_irq_count[core_pos]++;
+
+	return 0;
+}
+
+static test_result_t timer_per_cpu_concurrent(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	unsigned long time_out_ms = tftf_get_timer_step_value();
+	unsigned long long time_out_ticks, start;
+	test_result_t result = TEST_RESULT_SUCCESS;
+	int ret;
+
+	time_out_ticks = (read_cntfrq_el0() / 1000U) * time_out_ms;
+
+	ret = tftf_timer_register_handler(per_cpu_timer_handler);
+	tftf_send_event(&cpu_ready[core_pos]);
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to register timer handler:0x%x\n", ret);
+		return TEST_RESULT_FAIL;
+	}
+
+	/* Wait for all cores to be up */
+	while (!all_cores_inside_test)
+		;
+
+	for (unsigned int i = 0U; i < PER_CPU_TIMER_ROUNDS; i++) {
+		timer_irq_count[core_pos] = 0U;
+
+		/* All CPUs program their timer at about the same time */
+		start = syscounter_read();
+		ret = tftf_program_timer(time_out_ms);
+		if (ret != 0) {
+			tftf_testcase_printf("CPU%u: failed to program timer:0x%x\n",
+					     core_pos, ret);
+			result = TEST_RESULT_FAIL;
+			break;
+		}
+
+		while (timer_irq_count[core_pos] == 0U)
+			;
+
+		/*
+		 * The interrupt must come from the timer of this CPU, not be
+		 * relayed with IRQ_WAKE_SGI, and not before the deadline.
+		 */
+		if (timer_irq_id[core_pos] != tftf_get_timer_irq()) {
+			tftf_testcase_printf("CPU%u: woken up by IRQ %u\n",
+					     core_pos, timer_irq_id[core_pos]);
+			result = TEST_RESULT_FAIL;
+			break;
+		}
+
+		if ((timer_irq_time[core_pos] - start) < time_out_ticks) {
+			tftf_testcase_printf("CPU%u: timer fired %llu ticks early\n",
+				core_pos, time_out_ticks -
+				(timer_irq_time[core_pos] - start));
+			result = TEST_RESULT_FAIL;
+			break;
+		}
+	}
+
+	/* Don't leave a pending request if the loop was exited early */
+	tftf_cancel_timer();
+
+	if ((result == TEST_RESULT_SUCCESS) && (timer_irq_count[core_pos] != 1U)) {
+		tftf_testcase_printf("CPU%u: %u timer interrupts for 1 request\n",
+				     core_pos, timer_irq_count[core_pos]);
+		result = TEST_RESULT_FAIL;
+	}
+
+	ret = tftf_timer_unregister_handler();
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to unregister timer handler:0x%x\n", ret);
+		return TEST_RESULT_FAIL;
+	}
+
+	return result;
+}
+
+/*
+ * @Test_Aim@ Validates the timer framework with a per-CPU timer, when all the
+ * cores program the timer at the same time.
+ *
+ * Power up all the cores. Each core then repeatedly programs a timer interrupt
+ * with tftf_program_timer() and checks that it is delivered by its own timer,
+ * and not before the requested timeout.
+ *
+ * Returns SKIPPED if the platform timer is shared by all the cores, SUCCESS if
+ * all the cores get the expected interrupts.
+ */
+test_result_t test_timer_per_cpu_concurrent(void)
+{
+	unsigned int lead_mpid = read_mpidr_el1() & MPID_MASK;
+	unsigned int cpu_mpid, cpu_node;
+	unsigned int core_pos;
+	unsigned int rc;
+
+	SKIP_TEST_IF_LESS_THAN_N_CPUS(2);
+
+	if (!tftf_timer_is_per_cpu()) {
+		tftf_testcase_printf("The platform timer isn't per-CPU\n");
+		return TEST_RESULT_SKIPPED;
+	}
+
+	for (unsigned int i = 0; i < PLATFORM_CORE_COUNT; i++) {
+		tftf_init_event(&cpu_ready[i]);
+		timer_irq_count[i] = 0U;
+	}
+
+	all_cores_inside_test = 0;
+
+	/*
+	 * Preparation step: Power on all cores.
+	 */
+	for_each_cpu(cpu_node) {
+		cpu_mpid = tftf_get_mpidr_from_node(cpu_node);
+		/* Skip lead CPU as it is already on */
+		if (cpu_mpid == lead_mpid)
+			continue;
+
+		rc = tftf_cpu_on(cpu_mpid,
+				(uintptr_t) timer_per_cpu_concurrent,
+				0);
+		if (rc != PSCI_E_SUCCESS) {
+			tftf_testcase_printf(
+			"Failed to power on CPU 0x%x (%d)\n",
+			cpu_mpid, rc);
+			return TEST_RESULT_SKIPPED;
+		}
+	}
+
+	/* Wait for all non-lead CPUs to be ready */
+	for_each_cpu(cpu_node) {
+		cpu_mpid = tftf_get_mpidr_from_node(cpu_node);
+		/* Skip lead CPU */
+		if (cpu_mpid == lead_mpid)
+			continue;
+
+		core_pos = platform_get_core_pos(cpu_mpid);
+		tftf_wait_for_event(&cpu_ready[core_pos]);
+	}
+
+	all_cores_inside_test = 1;
+
+	return timer_per_cpu_concurrent();
+}
+
+static int timer_record_handler(void *data)
+{
+	(void)data;
+
+	if (timer_records < TIMER_REQS_PER_CORE)
+		timer_record_time[timer_records] = syscounter_read();
+	timer_records++;
+
+	return 0;
+}
+
+static inline unsigned long long timer_us_to_ticks(unsigned long long us)
+{
+	return (us * read_cntfrq_el0()) / 1000000U;
+}
+
+/*
+ * Wait for at most 'max_us' microseconds until 'count' timer interrupts have
+ * been received. Returns false on timeout.
+ */
+static bool timer_wait_records(unsigned int count, unsigned long long max_us)
+{
+	unsigned long long end = syscounter_read() + timer_us_to_ticks(max_us);
+
+	while (timer_records < count) {
+		if (syscounter_read() > end)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * @Test_Aim@ Validates that the timer framework handles several outstanding
+ * requests on a core.
+ *
+ * Make all the requests a core can have, out of order, and cancel one that
+ * isn't the next one to expire. Check that one more request is refused, that
+ * the cancelled request doesn't fire and that the others fire in order of
+ * their deadline.
+ *
+ * Returns SUCCESS if the interrupts are received in the expected order.
+ */
+test_result_t test_timer_multiple_requests(void)
+{
+	/* Expected expiry times of the requests which aren't cancelled */
+	static const unsigned int expected_us[] = { 1000U, 3000U, 7000U };
+	test_result_t result = TEST_RESULT_SUCCESS;
+	unsigned long long start, elapsed;
+	int req_late, req_cancel, req_first, req_extra, ret;
+
+	timer_records = 0U;
+
+	ret = tftf_timer_register_handler(timer_record_handler);
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to register timer handler:0x%x\n", ret);
+		return TEST_RESULT_FAIL;
+	}
+
+	start = syscounter_read();
+	req_late = tftf_timer_req_us(7000U);
+	req_cancel = tftf_timer_req_us(5000U);
+	ret = tftf_program_timer_us(3000U);
+	req_first = tftf_timer_req_us(1000U);
+	if ((req_late < 0) || (req_cancel < 0) || (ret != 0) ||
+	    (req_first < 0)) {
+		tftf_testcase_printf("Failed to make the timer requests\n");
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	/* All the requests of this core are in use */
+	req_extra = tftf_timer_req_us(1000U);
+	if (req_extra >= 0) {
+		tftf_testcase_printf("Request %d made beyond the limit of %d\n",
+				     req_extra, TIMER_REQS_PER_CORE);
+		tftf_cancel_timer_req(req_extra);
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	ret = tftf_cancel_timer_req(req_cancel);
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to cancel timer request:0x%x\n", ret);
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	/* Leave time for the cancelled request to fire if it wasn't removed */
+	if (!timer_wait_records(ARRAY_SIZE(expected_us), 20000U)) {
+		tftf_testcase_printf("Received %u timer interrupts out of %u\n",
+				     timer_records,
+				     (unsigned int)ARRAY_SIZE(expected_us));
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+	waitus(2000U);
+
+	if (timer_records != ARRAY_SIZE(expected_us)) {
+		tftf_testcase_printf("Received %u timer interrupts, expected %u\n",
+				     timer_records,
+				     (unsigned int)ARRAY_SIZE(expected_us));
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	/*
+	 * Each interrupt must come after the deadline of its request and before
+	 * the deadline of the next one.
+	 */
+	for (unsigned int i = 0U; i < ARRAY_SIZE(expected_us); i++) {
+		elapsed = timer_record_time[i] - start;
+		if ((elapsed < timer_us_to_ticks(expected_us[i])) ||
+		    (((i + 1U) < ARRAY_SIZE(expected_us)) &&
+		     (elapsed >= timer_us_to_ticks(expected_us[i + 1U])))) {
+			tftf_testcase_printf("Interrupt %u after %llu ticks, expected after %uus\n",
+					     i, elapsed, expected_us[i]);
+			result = TEST_RESULT_FAIL;
+		}
+	}
+
+exit:
+	/* Clean up the requests that may still be pending after a failure */
+	tftf_cancel_timer();
+	if (req_late > 0)
+		tftf_cancel_timer_req(req_late);
+	if (req_cancel > 0)
+		tftf_cancel_timer_req(req_cancel);
+	if (req_first > 0)
+		tftf_cancel_timer_req(req_first);
+
+	ret = tftf_timer_unregister_handler();
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to unregister timer handler:0x%x\n", ret);
+		return TEST_RESULT_FAIL;
+	}
+
+	return result;
+}
+
+/*
+ * Make a request of 'time_out_us' microseconds with 'program' and check that
+ * its interrupt is received within TIMER_MAX_LATENCY_US of its deadline.
+ */
+static test_result_t timer_check_us_request(int (*program)(unsigned long),
+					    unsigned long time_out_us)
+{
+	unsigned long long start, elapsed;
+	int ret;
+
+	timer_records = 0U;
+
+	start = syscounter_read();
+	ret = program(time_out_us);
+	if (ret < 0) {
+		tftf_testcase_printf("Failed to program a %luus timer\n",
+				     time_out_us);
+		return TEST_RESULT_FAIL;
+	}
+
+	if (!timer_wait_records(1U, time_out_us + 10000U)) {
+		tftf_testcase_printf("No interrupt for a %luus timer\n",
+				     time_out_us);
+		/* The request made with tftf_program_timer_us() has ID 0 */
+		if (ret > 0)
+			tftf_cancel_timer_req(ret);
+		return TEST_RESULT_FAIL;
+	}
+
+	elapsed = timer_record_time[0] - start;
+	if ((elapsed < timer_us_to_ticks(time_out_us)) ||
+	    (elapsed > timer_us_to_ticks(time_out_us + TIMER_MAX_LATENCY_US))) {
+		tftf_testcase_printf("%luus timer fired after %llu ticks\n",
+				     time_out_us, elapsed);
+		return TEST_RESULT_FAIL;
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Validates the accuracy of the timer requests made in
+ * microseconds.
+ *
+ * Make requests shorter than a millisecond with tftf_program_timer_us() and
+ * tftf_timer_req_us(), and check that their interrupts are received within
+ * TIMER_MAX_LATENCY_US of their deadline. Then cancel a request, alone and
+ * when it is the first of two to expire, and check that only the other one
+ * fires.
+ *
+ * Returns SKIPPED if the platform timer can't be programmed with a deadline,
+ * SUCCESS if all the interrupts are received on time.
+ */
+test_result_t test_timer_us_accuracy(void)
+{
+	static const unsigned long time_outs_us[] = { 50U, 100U, 250U, 500U };
+	test_result_t result = TEST_RESULT_SUCCESS;
+	unsigned long long start, elapsed;
+	int req, ret;
+
+	if (!tftf_timer_has_us_resolution()) {
+		tftf_testcase_printf("The platform timer has a 1ms resolution\n");
+		return TEST_RESULT_SKIPPED;
+	}
+
+	ret = tftf_timer_register_handler(timer_record_handler);
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to register timer handler:0x%x\n", ret);
+		return TEST_RESULT_FAIL;
+	}
+
+	for (unsigned int i = 0U; i < ARRAY_SIZE(time_outs_us); i++) {
+		result = timer_check_us_request(tftf_program_timer_us,
+						time_outs_us[i]);
+		if (result != TEST_RESULT_SUCCESS)
+			goto exit;
+
+		result = timer_check_us_request(tftf_timer_req_us,
+						time_outs_us[i]);
+		if (result != TEST_RESULT_SUCCESS)
+			goto exit;
+	}
+
+	/* A cancelled request never fires */
+	timer_records = 0U;
+	req = tftf_timer_req_us(500U);
+	if ((req < 0) || (tftf_cancel_timer_req(req) != 0)) {
+		tftf_testcase_printf("Failed to make and cancel a request\n");
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	waitus(1000U);
+	if (timer_records != 0U) {
+		tftf_testcase_printf("Cancelled timer request fired\n");
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	/*
+	 * Cancelling the first request to expire moves the timer to the next
+	 * one, which must still fire on time.
+	 */
+	start = syscounter_read();
+	ret = tftf_program_timer_us(600U);
+	req = tftf_timer_req_us(300U);
+	if ((ret != 0) || (req < 0) || (tftf_cancel_timer_req(req) != 0)) {
+		tftf_testcase_printf("Failed to make and cancel a request\n");
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	if (!timer_wait_records(1U, 10000U)) {
+		tftf_testcase_printf("No interrupt after cancelling a request\n");
+		result = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	elapsed = timer_record_time[0] - start;
+	if ((elapsed < timer_us_to_ticks(600U)) ||
+	    (elapsed > timer_us_to_ticks(600U + TIMER_MAX_LATENCY_US))) {
+		tftf_testcase_printf("600us timer fired after %llu ticks\n",
+				     elapsed);
+		result = TEST_RESULT_FAIL;
+	}
+
+exit:
+	/* Clean up the request that may still be pending after a failure */
+	tftf_cancel_timer();
+
+	ret = tftf_timer_unregister_handler();
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to unregister timer handler:0x%x\n", ret);
+		return TEST_RESULT_FAIL;
+	}
+
+	return result;
+}
+
 static test_result_t do_stress_test(void)
 {
 	unsigned int power_state;
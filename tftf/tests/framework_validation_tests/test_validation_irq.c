@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -41,6 +41,7 @@ test_result_t test_validation_irq(void)
 	unsigned int mpid = read_mpidr_el1();
 	unsigned int core_pos = platform_get_core_pos(mpid);
 	const unsigned int sgi_id = IRQ_NS_SGI_0;
+	irq_stats_t stats = { 0 };
 	int ret;
 
 	counter = 0;
@@ -78,7 +79,7 @@ test_result_t test_validation_irq(void)
 	if (ret == 0) {
 		tftf_testcase_printf(
 			"Overwriting the IRQ handler should have failed\n");
-		return TEST_RESULT_FAIL;
+		goto fail_unregister;
 	}
 #endif
 
@@ -86,10 +87,24 @@ test_result_t test_validation_irq(void)
 	while (counter != 2)
 		;
 
+	/* Both calls to the handler must have been accounted for */
+	ret = tftf_irq_get_stats_sgi(sgi_id, &stats);
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to get IRQ handler statistics\n");
+		goto fail_unregister;
+	}
+
+	if (stats.count != 2U) {
+		tftf_testcase_printf("Wrong IRQ handler statistics (count %llu)\n",
+				     (unsigned long long)stats.count);
+		goto fail_unregister;
+	}
+
 	/* Unregister the IRQ handler */
 	ret = tftf_irq_unregister_handler_sgi(IRQ_NS_SGI_0);
 	if (ret != 0) {
 		tftf_testcase_printf("Failed to unregister IRQ handler\n");
+		tftf_irq_disable_sgi(sgi_id);
 		return TEST_RESULT_FAIL;
 	}
 
@@ -111,6 +126,12 @@ test_result_t test_validation_irq(void)
 		return TEST_RESULT_FAIL;
 	}
 
+	if (tftf_irq_get_stats_sgi(sgi_id, &stats) == 0) {
+		tftf_testcase_printf(
+			"Statistics of an unregistered IRQ handler returned\n");
+		return TEST_RESULT_FAIL;
+	}
+
 	/*
 	 * Try to unregister the IRQ handler again. This should fail.
 	 * In debug builds, it would trigger an assertion so we can't test that
@@ -129,4 +150,11 @@ test_result_t test_validation_irq(void)
 	tftf_irq_disable_sgi(sgi_id);
 
 	return TEST_RESULT_SUCCESS;
+
+fail_unregister:
+	/* The handler is still registered when the test fails before that */
+	tftf_irq_disable_sgi(sgi_id);
+	tftf_irq_unregister_handler_sgi(sgi_id);
+
+	return TEST_RESULT_FAIL;
 }
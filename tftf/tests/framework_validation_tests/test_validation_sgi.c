@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,8 +7,13 @@
 #include <arch_helpers.h>
 #include <debug.h>
 #include <drivers/arm/arm_gic.h>
+#include <events.h>
 #include <irq.h>
+#include <plat_topology.h>
 #include <platform.h>
+#include <power_management.h>
+#include <psci.h>
+#include <stdbool.h>
 #include <tftf_lib.h>
 
 /*
@@ -80,3 +85,153 @@ test_result_t test_validation_sgi(void)
 
 	return test_res;
 }
+
+/* Number of SGIs received by each core in the multicast test */
+static volatile unsigned int multicast_sgi_count[PLATFORM_CORE_COUNT];
+/* Set when a core fails to set up the multicast test, to release the others */
+static volatile bool multicast_sgi_abort;
+static event_t cpu_ready[PLATFORM_CORE_COUNT];
+static event_t cpu_done[PLATFORM_CORE_COUNT];
+
+static int multicast_sgi_handler(void *data)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	multicast_sgi_count[core_pos]++;
+
+	return 0;
+}
+
+static test_result_t non_lead_cpu_multicast_sgi(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	const unsigned int sgi_id = IRQ_NS_SGI_0;
+	int ret;
+
+	ret = tftf_irq_register_handler_sgi(sgi_id, multicast_sgi_handler);
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to register IRQ %u (%d)\n",
+				sgi_id, ret);
+		multicast_sgi_abort = true;
+		tftf_send_event(&cpu_ready[core_pos]);
+		tftf_send_event(&cpu_done[core_pos]);
+		return TEST_RESULT_FAIL;
+	}
+	tftf_irq_enable_sgi(sgi_id, GIC_HIGHEST_NS_PRIORITY);
+
+	tftf_send_event(&cpu_ready[core_pos]);
+
+	/* Wait for the multicast SGI and the broadcast one */
+	while ((multicast_sgi_count[core_pos] < 2U) && !multicast_sgi_abort)
+		continue;
+
+	tftf_irq_disable_sgi(sgi_id);
+	tftf_irq_unregister_handler_sgi(sgi_id);
+
+	tftf_send_event(&cpu_done[core_pos]);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Test multicast and broadcast SGIs
+ *
+ * 1) Power on all the cores and register an SGI handler on each of them.
+ * 2) Send an SGI to all the cores, including the lead CPU, with
+ *    tftf_send_sgi_multicast().
+ * 3) Send an SGI to all the cores but the lead CPU with tftf_send_sgi_others().
+ * 4) Check that every core has received the expected number of SGIs.
+ */
+test_result_t test_validation_sgi_multicast(void)
+{
+	u_register_t lead_mpid = read_mpidr_el1() & MPID_MASK;
+	unsigned int lead_pos = platform_get_core_pos(lead_mpid);
+	const unsigned int sgi_id = IRQ_NS_SGI_0;
+	bool targets[PLATFORM_CORE_COUNT] = { false };
+	bool started[PLATFORM_CORE_COUNT] = { false };
+	test_result_t test_res = TEST_RESULT_SUCCESS;
+	unsigned int target_node, core_pos;
+	u_register_t target_mpid;
+	int ret;
+
+	multicast_sgi_abort = false;
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		multicast_sgi_count[i] = 0U;
+		tftf_init_event(&cpu_ready[i]);
+		tftf_init_event(&cpu_done[i]);
+	}
+
+	ret = tftf_irq_register_handler_sgi(sgi_id, multicast_sgi_handler);
+	if (ret != 0) {
+		tftf_testcase_printf("Failed to register IRQ %u (%d)\n",
+				sgi_id, ret);
+		return TEST_RESULT_FAIL;
+	}
+	tftf_irq_enable_sgi(sgi_id, GIC_HIGHEST_NS_PRIORITY);
+
+	for_each_cpu(target_node) {
+		target_mpid = tftf_get_mpidr_from_node(target_node);
+		core_pos = platform_get_core_pos(target_mpid);
+		targets[core_pos] = true;
+
+		if (target_mpid == lead_mpid)
+			continue;
+
+		ret = tftf_cpu_on(target_mpid,
+				(uintptr_t)non_lead_cpu_multicast_sgi, 0);
+		if (ret != PSCI_E_SUCCESS) {
+			tftf_testcase_printf("Failed to power on CPU 0x%llx (%d)\n",
+					(unsigned long long)target_mpid, ret);
+			multicast_sgi_abort = true;
+			test_res = TEST_RESULT_FAIL;
+			goto exit;
+		}
+		started[core_pos] = true;
+		tftf_wait_for_event(&cpu_ready[core_pos]);
+	}
+
+	if (multicast_sgi_abort) {
+		test_res = TEST_RESULT_FAIL;
+		goto exit;
+	}
+
+	tftf_send_sgi_multicast(sgi_id, targets);
+
+	/*
+	 * Wait for every core to have handled the multicast SGI before sending
+	 * the broadcast one. Otherwise both could be pending at the same time
+	 * on a core, which would only see a single interrupt.
+	 */
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (!targets[i])
+			continue;
+
+		while (multicast_sgi_count[i] == 0U)
+			continue;
+	}
+
+	tftf_send_sgi_others(sgi_id);
+
+exit:
+	/*
+	 * Wait for the cores which were powered on. If the test was aborted,
+	 * they stop waiting for SGIs and unregister their handler.
+	 */
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (started[i])
+			tftf_wait_for_event(&cpu_done[i]);
+	}
+
+	tftf_irq_disable_sgi(sgi_id);
+	tftf_irq_unregister_handler_sgi(sgi_id);
+
+	/* The broadcast SGI must not have reached the sender */
+	if ((test_res == TEST_RESULT_SUCCESS) &&
+	    (multicast_sgi_count[lead_pos] != 1U)) {
+		tftf_testcase_printf("Lead CPU received %u SGIs, expected 1\n",
+				multicast_sgi_count[lead_pos]);
+		test_res = TEST_RESULT_FAIL;
+	}
+
+	return test_res;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <arch_helpers.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <tftf_lib.h>
+
+#include "perf_stats.h"
+
+unsigned long long perf_ticks_to_ns(unsigned long long ticks)
+{
+	unsigned long long freq = read_cntfrq_el0();
+	return (ticks * 1000000000ULL) / freq;
+}
+
+unsigned long long perf_ops_per_sec(unsigned long long count,
+				    unsigned long long ticks)
+{
+	if (ticks == 0U)
+		return 0U;
+
+	return (count * read_cntfrq_el0()) / ticks;
+}
+
+static int perf_sample_cmp(const void *a, const void *b)
+{
+	unsigned long long x = *(const unsigned long long *)a;
+	unsigned long long y = *(const unsigned long long *)b;
+
+	return (x > y) - (x < y);
+}
+
+void perf_stats_compute(unsigned long long *samples, unsigned int count,
+			struct perf_stats *stats)
+{
+	assert(count > 0U);
+
+	qsort(samples, count, sizeof(samples[0]), perf_sample_cmp);
+
+	stats->p50 = perf_ticks_to_ns(samples[((count - 1U) * 50U) / 100U]);
+	stats->p90 = perf_ticks_to_ns(samples[((count - 1U) * 90U) / 100U]);
+	stats->p99 = perf_ticks_to_ns(samples[((count - 1U) * 99U) / 100U]);
+	stats->max = perf_ticks_to_ns(samples[count - 1U]);
+}
+
+void perf_stats_print(const char *name, const struct perf_stats *stats)
+{
+	tftf_testcase_printf("%s: p50 %llu ns, p90 %llu ns, p99 %llu ns, max %llu ns\n",
+			     name, stats->p50, stats->p90, stats->p99,
+			     stats->max);
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PERF_STATS_H
+#define PERF_STATS_H
+
+/*
+ * Helpers shared by the benchmarks to summarise samples of durations, taken
+ * in system counter ticks, as percentiles in nanoseconds.
+ */
+
+/* Percentiles of a set of samples, in nanoseconds */
+struct perf_stats {
+	unsigned long long p50;
+	unsigned long long p90;
+	unsigned long long p99;
+	unsigned long long max;
+};
+
+/* Convert a number of system counter ticks to nanoseconds. */
+unsigned long long perf_ticks_to_ns(unsigned long long ticks);
+
+/*
+ * Return the number of operations per second, given that 'count' operations
+ * took 'ticks' system counter ticks.
+ */
+unsigned long long perf_ops_per_sec(unsigned long long count,
+				    unsigned long long ticks);
+
+/*
+ * Sort the 'count' samples, in system counter ticks, and extract the
+ * percentiles from them.
+ */
+void perf_stats_compute(unsigned long long *samples, unsigned int count,
+			struct perf_stats *stats);
+
+/* Print the percentiles as a line of the test output, prefixed by 'name'. */
+void perf_stats_print(const char *name, const struct perf_stats *stats);
+
+#endif /* PERF_STATS_H */
@@ -0,0 +1,498 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains benchmarks of FF-A direct messaging between the normal
+ * world and the Secure Partitions:
+ *  - the round trip latency of FFA_MSG_SEND_DIRECT_REQ/RESP from the lead CPU,
+ *    with the SMC32 and SMC64 conventions, to each Cactus partition;
+ *  - the same latency to the S-EL0 Ivy partition, compared to the S-EL1
+ *    Cactus one;
+ *  - the aggregate throughput of echo commands sent by all the cores at the
+ *    same time to a multi-core partition;
+ *  - the split of the round trip in legs, from the times at which Cactus
+ *    received the request, called the echo handler and sent the response.
+ *
+ * A round trip is timed from before the request is issued to after the
+ * response has been received, so it includes the SPMD, the SPMC and the
+ * handling of the echo command by the partition. Latencies are reported in
+ * nanoseconds as percentiles of the samples. The tests only fail when a
+ * message doesn't get the expected response.
+ */
+
+#include <arch_helpers.h>
+#include <cactus_test_cmds.h>
+#include <debug.h>
+#include <events.h>
+#include <ffa_endpoints.h>
+#include <ffa_helpers.h>
+#include <plat_topology.h>
+#include <platform.h>
+#include <platform_def.h>
+#include <power_management.h>
+#include <psci.h>
+#include <spm_common.h>
+#include <spm_test_helpers.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <test_helpers.h>
+#include <tftf_lib.h>
+
+#include "perf_stats.h"
+
+#define DIRECT_MSG_WARMUP		16U
+#define DIRECT_MSG_ITERATIONS		1000U
+#define DIRECT_MSG_LEG_ITERATIONS	256U
+
+static const struct ffa_uuid expected_sp_uuids[] = {
+	{PRIMARY_UUID}, {SECONDARY_UUID}, {TERTIARY_UUID}
+};
+
+static const struct ffa_uuid expected_sel0_sp_uuids[] = {
+	{PRIMARY_UUID}, {IVY_UUID}
+};
+
+struct direct_msg_target {
+	const char *name;
+	ffa_id_t id;
+	bool smc64;
+	/* Ivy answers every request with zeros rather than echoing it */
+	bool echo;
+};
+
+static const struct direct_msg_target sel1_targets[] = {
+	{ "SP1 (S-EL1, MP) SMC64", SP_ID(1), true, true },
+	{ "SP1 (S-EL1, MP) SMC32", SP_ID(1), false, true },
+	{ "SP2 (S-EL1, MP) SMC64", SP_ID(2), true, true },
+	{ "SP3 (S-EL1, UP) SMC64", SP_ID(3), true, true },
+};
+
+static const struct direct_msg_target sel1_ref_target = {
+	"SP1 (S-EL1, MP) SMC32", SP_ID(1), false, true
+};
+
+static const struct direct_msg_target sel0_target = {
+	"Ivy (S-EL0, UP) SMC32", SP_ID(4), false, false
+};
+
+static const struct direct_msg_target mc_target = {
+	"SP1 (S-EL1, MP) SMC64", SP_ID(1), true, true
+};
+
+/* Round trip samples of each core, in system counter ticks */
+static unsigned long long samples[PLATFORM_CORE_COUNT][DIRECT_MSG_ITERATIONS];
+
+static bool direct_msg_send(const struct direct_msg_target *target,
+			    uint32_t val)
+{
+	struct ffa_value ret;
+
+	if (target->smc64) {
+		ret = cactus_echo_send_cmd(HYP_ID, target->id, val);
+	} else {
+		ret = cactus_echo32_send_cmd(HYP_ID, target->id, val);
+	}
+
+	if (!is_ffa_direct_response(ret)) {
+		return false;
+	}
+
+	return !target->echo ||
+	       ((cactus_get_response(ret) == CACTUS_SUCCESS) &&
+		(cactus_echo_get_val(ret) == val));
+}
+
+/*
+ * Time 'count' round trips to 'target' from the calling core, after a few
+ * untimed ones to warm up the caches and TLBs. 'start' and 'end' are set to
+ * the time of the first request and of the last response.
+ */
+static int direct_msg_measure(const struct direct_msg_target *target,
+			      unsigned long long *samples_out,
+			      unsigned int count,
+			      unsigned long long *start,
+			      unsigned long long *end)
+{
+	unsigned long long t0;
+
+	for (unsigned int i = 0U; i < DIRECT_MSG_WARMUP; i++) {
+		if (!direct_msg_send(target, i)) {
+			ERROR("%s: no response to warm-up message %u\n",
+			      target->name, i);
+			return -1;
+		}
+	}
+
+	*start = syscounter_read();
+
+	for (unsigned int i = 0U; i < count; i++) {
+		t0 = syscounter_read();
+		if (!direct_msg_send(target, ECHO_VAL1 + i)) {
+			ERROR("%s: wrong response to message %u\n",
+			      target->name, i);
+			return -1;
+		}
+		samples_out[i] = syscounter_read() - t0;
+	}
+
+	*end = syscounter_read();
+
+	return 0;
+}
+
+/*
+ * Measure the latency to 'target' from the calling core, print it and return
+ * its percentiles in 'stats'.
+ */
+static int direct_msg_latency(const struct direct_msg_target *target,
+			      struct perf_stats *stats)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	unsigned long long start, end;
+
+	if (direct_msg_measure(target, samples[core_pos],
+			       DIRECT_MSG_ITERATIONS, &start, &end) != 0) {
+		return -1;
+	}
+
+	perf_stats_compute(samples[core_pos], DIRECT_MSG_ITERATIONS, stats);
+	perf_stats_print(target->name, stats);
+	tftf_testcase_printf("%s: %llu messages/s\n", target->name,
+			     perf_ops_per_sec(DIRECT_MSG_ITERATIONS,
+					      end - start));
+
+	return 0;
+}
+
+/*
+ * @Test_Aim@ Measure the round trip latency of direct messages to the S-EL1
+ * partitions
+ *
+ * From the lead CPU, send echo commands back to back to each Cactus
+ * partition, with both calling conventions, and report the latency
+ * percentiles and the resulting message rate.
+ */
+test_result_t test_ffa_direct_msg_latency(void)
+{
+	struct perf_stats stats;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sp_uuids);
+
+	for (unsigned int i = 0U; i < ARRAY_SIZE(sel1_targets); i++) {
+		if (direct_msg_latency(&sel1_targets[i], &stats) != 0) {
+			return TEST_RESULT_FAIL;
+		}
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Compare the round trip latency of direct messages to an S-EL0
+ * partition with the one to an S-EL1 partition
+ *
+ * Both partitions are sent SMC32 requests from the lead CPU. The ratio of the
+ * median latencies shows the cost of the S-EL0 partition model.
+ */
+test_result_t test_ffa_direct_msg_latency_sel0(void)
+{
+	struct perf_stats sel1_stats, sel0_stats;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sel0_sp_uuids);
+
+	if ((direct_msg_latency(&sel1_ref_target, &sel1_stats) != 0) ||
+	    (direct_msg_latency(&sel0_target, &sel0_stats) != 0)) {
+		return TEST_RESULT_FAIL;
+	}
+
+	if (sel1_stats.p50 != 0U) {
+		tftf_testcase_printf("S-EL0/S-EL1 median latency ratio: %llu.%02llu\n",
+				     sel0_stats.p50 / sel1_stats.p50,
+				     ((sel0_stats.p50 * 100U) / sel1_stats.p50) %
+				     100U);
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+enum direct_msg_leg {
+	/* From the request to the entry in the Cactus command dispatcher */
+	LEG_REQUEST = 0,
+	/* From there to the call of the command handler */
+	LEG_DISPATCH,
+	/* From there to the response */
+	LEG_HANDLER,
+	/* From the response to its return to the normal world */
+	LEG_RESPONSE,
+	LEG_COUNT
+};
+
+static const char * const leg_names[LEG_COUNT] = {
+	"request", "dispatch", "handler", "response"
+};
+
+static unsigned long long leg_samples[LEG_COUNT][DIRECT_MSG_LEG_ITERATIONS];
+
+/*
+ * Time the legs of round trips to 'target' and print the median and 99th
+ * percentile of each of them on one line. Return 1 if the counter of the SP is not in line with the one of the normal
+ * world, -1 if a message didn't get the expected response.
+ */
+static int direct_msg_legs(const struct direct_msg_target *target)
+{
+	unsigned long long t0, t1, entry, handler, response;
+	struct perf_stats stats[LEG_COUNT];
+	struct ffa_value ret;
+
+	for (unsigned int i = 0U; i < DIRECT_MSG_LEG_ITERATIONS; i++) {
+		t0 = syscounter_read();
+		if (!direct_msg_send(target, ECHO_VAL1 + i)) {
+			ERROR("%s: wrong response to message %u\n",
+			      target->name, i);
+			return -1;
+		}
+		t1 = syscounter_read();
+
+		ret = cactus_get_cmd_timing_send_cmd(HYP_ID, target->id);
+		if (!is_ffa_direct_response(ret) ||
+		    (cactus_get_response(ret) != CACTUS_SUCCESS) ||
+		    (cactus_get_cmd_timing_cmd_id(ret) != CACTUS_ECHO_CMD)) {
+			ERROR("%s: failed to get the timing of message %u\n",
+			      target->name, i);
+			return -1;
+		}
+
+		entry = cactus_get_cmd_timing_entry(ret);
+		handler = cactus_get_cmd_timing_handler(ret);
+		response = cactus_get_cmd_timing_response(ret);
+
+		if ((entry < t0) || (response > t1)) {
+			return 1;
+		}
+
+		leg_samples[LEG_REQUEST][i] = entry - t0;
+		leg_samples[LEG_DISPATCH][i] = handler - entry;
+		leg_samples[LEG_HANDLER][i] = response - handler;
+		leg_samples[LEG_RESPONSE][i] = t1 - response;
+	}
+
+	for (unsigned int l = 0U; l < LEG_COUNT; l++) {
+		perf_stats_compute(leg_samples[l], DIRECT_MSG_LEG_ITERATIONS,
+				   &stats[l]);
+	}
+
+	tftf_testcase_printf("%-21s %6llu/%-6llu %6llu/%-6llu %6llu/%-6llu %6llu/%-6llu\n",
+			     target->name,
+			     stats[LEG_REQUEST].p50, stats[LEG_REQUEST].p99,
+			     stats[LEG_DISPATCH].p50, stats[LEG_DISPATCH].p99,
+			     stats[LEG_HANDLER].p50, stats[LEG_HANDLER].p99,
+			     stats[LEG_RESPONSE].p50, stats[LEG_RESPONSE].p99);
+
+	return 0;
+}
+
+/*
+ * @Test_Aim@ Split the round trip latency of direct messages in its legs
+ *
+ * Send echo commands to each Cactus partition and, after each of them, ask
+ * the partition when it received it, called the handler and sent the
+ * response. Report the percentiles of each leg, one line per partition and
+ * calling convention. The request leg includes the
+ * SPMD, the SPMC and the dispatch of the request to the partition: the round
+ * trip of FFA_ID_GET, which the SPMC handles itself, is reported as a
+ * reference to split it further.
+ *
+ * The times of the partition are read from its virtual counter, so the test
+ * is skipped if the SPMC offsets it from the physical one.
+ */
+test_result_t test_ffa_direct_msg_latency_breakdown(void)
+{
+	struct perf_stats stats;
+	struct ffa_value ret;
+	unsigned long long t0;
+	int result;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sp_uuids);
+
+	for (unsigned int i = 0U; i < DIRECT_MSG_LEG_ITERATIONS; i++) {
+		t0 = syscounter_read();
+		ret = ffa_id_get();
+		leg_samples[LEG_REQUEST][i] = syscounter_read() - t0;
+
+		if (is_ffa_call_error(ret)) {
+			ERROR("FFA_ID_GET failed\n");
+			return TEST_RESULT_FAIL;
+		}
+	}
+
+	perf_stats_compute(leg_samples[LEG_REQUEST], DIRECT_MSG_LEG_ITERATIONS,
+			   &stats);
+	perf_stats_print("FFA_ID_GET round trip", &stats);
+
+	tftf_testcase_printf("p50/p99 ns\n%-21s %13s %13s %13s %13s\n", "",
+			     leg_names[LEG_REQUEST], leg_names[LEG_DISPATCH],
+			     leg_names[LEG_HANDLER], leg_names[LEG_RESPONSE]);
+
+	for (unsigned int i = 0U; i < ARRAY_SIZE(sel1_targets); i++) {
+		result = direct_msg_legs(&sel1_targets[i]);
+		if (result < 0) {
+			return TEST_RESULT_FAIL;
+		}
+
+		if (result > 0) {
+			tftf_testcase_printf("The SP counter is offset from the normal world one\n");
+			return TEST_RESULT_SKIPPED;
+		}
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * Throughput of all the cores at once.
+ *
+ * Every core is powered on and waits for the lead CPU to set mc_go, so that
+ * they all start sending messages at the same time.
+ */
+static volatile bool mc_go;
+static volatile bool mc_failed;
+static bool mc_cpu[PLATFORM_CORE_COUNT];
+static unsigned long long mc_start[PLATFORM_CORE_COUNT];
+static unsigned long long mc_end[PLATFORM_CORE_COUNT];
+static event_t mc_ready[PLATFORM_CORE_COUNT];
+static event_t mc_done[PLATFORM_CORE_COUNT];
+
+static void direct_msg_mc_run(unsigned int core_pos)
+{
+	while (!mc_go)
+		;
+
+	if (direct_msg_measure(&mc_target, samples[core_pos],
+			       DIRECT_MSG_ITERATIONS, &mc_start[core_pos],
+			       &mc_end[core_pos]) != 0) {
+		mc_failed = true;
+	}
+}
+
+static test_result_t direct_msg_mc_worker(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	tftf_send_event(&mc_ready[core_pos]);
+	direct_msg_mc_run(core_pos);
+	tftf_send_event(&mc_done[core_pos]);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Measure the aggregate throughput of direct messages sent by all
+ * the cores concurrently
+ *
+ * Every core sends echo commands back to back to the multi-core partition
+ * SP1, which has an execution context pinned on each of them. Report the
+ * latency percentiles of each core and of all of them, and the aggregate
+ * message rate from the first request to the last response.
+ */
+test_result_t test_ffa_direct_msg_throughput_all_cpus(void)
+{
+	u_register_t lead_mpid = read_mpidr_el1() & MPID_MASK;
+	unsigned int lead_pos = platform_get_core_pos(lead_mpid);
+	unsigned long long first_start = ~0ULL, last_end = 0U;
+	unsigned int cpu_node, core_pos, num_cpus = 0U;
+	struct perf_stats stats;
+	u_register_t mpidr;
+	char name[32];
+	int ret;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sp_uuids);
+
+	mc_go = false;
+	mc_failed = false;
+	memset(mc_cpu, 0, sizeof(mc_cpu));
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		tftf_init_event(&mc_ready[i]);
+		tftf_init_event(&mc_done[i]);
+	}
+
+	for_each_cpu(cpu_node) {
+		mpidr = tftf_get_mpidr_from_node(cpu_node);
+		core_pos = platform_get_core_pos(mpidr);
+
+		if (mpidr != lead_mpid) {
+			ret = tftf_cpu_on(mpidr, (uintptr_t)direct_msg_mc_worker,
+					  0U);
+			if (ret != PSCI_E_SUCCESS) {
+				ERROR("tftf_cpu_on mpidr 0x%llx returns %d\n",
+				      (unsigned long long)mpidr, ret);
+				mc_failed = true;
+				break;
+			}
+			tftf_wait_for_event(&mc_ready[core_pos]);
+		}
+
+		mc_cpu[core_pos] = true;
+	}
+
+	/* Release the cores which are online, even if some failed to start */
+	dsbish();
+	mc_go = true;
+	dsbish();
+	sev();
+
+	if (!mc_failed) {
+		direct_msg_mc_run(lead_pos);
+	}
+
+	for (core_pos = 0U; core_pos < PLATFORM_CORE_COUNT; core_pos++) {
+		if (mc_cpu[core_pos] && (core_pos != lead_pos)) {
+			tftf_wait_for_event(&mc_done[core_pos]);
+		}
+	}
+
+	if (mc_failed) {
+		return TEST_RESULT_FAIL;
+	}
+
+	/*
+	 * Print the latency of each core, then gather all the samples at the
+	 * start of the array to compute the overall latency.
+	 */
+	for (core_pos = 0U; core_pos < PLATFORM_CORE_COUNT; core_pos++) {
+		if (!mc_cpu[core_pos]) {
+			continue;
+		}
+
+		if (mc_start[core_pos] < first_start) {
+			first_start = mc_start[core_pos];
+		}
+		if (mc_end[core_pos] > last_end) {
+			last_end = mc_end[core_pos];
+		}
+
+		perf_stats_compute(samples[core_pos], DIRECT_MSG_ITERATIONS,
+				   &stats);
+		snprintf(name, sizeof(name), "Core %u", core_pos);
+		perf_stats_print(name, &stats);
+
+		if (num_cpus != core_pos) {
+			memcpy(samples[num_cpus], samples[core_pos],
+			       sizeof(samples[core_pos]));
+		}
+		num_cpus++;
+	}
+
+	perf_stats_compute(&samples[0][0], num_cpus * DIRECT_MSG_ITERATIONS,
+			   &stats);
+	perf_stats_print("All cores", &stats);
+	tftf_testcase_printf("%s from %u cores: %llu messages/s\n",
+			     mc_target.name, num_cpus,
+			     perf_ops_per_sec(num_cpus * DIRECT_MSG_ITERATIONS,
+					      last_end - first_start));
+
+	return TEST_RESULT_SUCCESS;
+}
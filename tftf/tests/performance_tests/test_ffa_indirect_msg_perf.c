@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains a benchmark of FF-A indirect messaging from a normal
+ * world VM to a Secure Partition. The TFTF maps RX/TX buffers on behalf of
+ * VM 1 and sends FFA_MSG_SEND2 messages from it to SP1, which is then asked
+ * to consume each message with a direct request.
+ *
+ * Every payload size is measured twice:
+ *  - copying: the payload is built in a separate buffer and copied to the TX
+ *    buffer, and the SP copies it out of its RX buffer before parsing it, as
+ *    send_indirect_message() and receive_indirect_message() do;
+ *  - in place: the payload is built directly in the TX buffer and parsed
+ *    directly in the RX buffer, with the zero-copy helpers.
+ *
+ * The send phase is timed from the start of the payload construction to the
+ * return of FFA_MSG_SEND2, and the cycle up to the response of the SP.
+ */
+
+#include <arch_helpers.h>
+#include <cactus_test_cmds.h>
+#include <debug.h>
+#include <ffa_endpoints.h>
+#include <ffa_helpers.h>
+#include <spm_common.h>
+#include <spm_test_helpers.h>
+#include <stdbool.h>
+#include <string.h>
+#include <test_helpers.h>
+#include <tftf_lib.h>
+
+#include "perf_stats.h"
+
+#define IND_MSG_ITERATIONS	256U
+#define IND_MSG_SENDER		VM_ID(1)
+#define IND_MSG_RECEIVER	SP_ID(1)
+
+static const struct ffa_uuid expected_sp_uuids[] = {
+	{PRIMARY_UUID}
+};
+
+static const size_t payload_sizes[] = {
+	64U, 1024U, FFA_PARTITION_MSG_PAYLOAD_MAX
+};
+
+/* RX/TX buffers of VM 1, mapped through the TFTF mailbox */
+static __aligned(PAGE_SIZE) uint8_t vm1_rx_buffer[PAGE_SIZE];
+static __aligned(PAGE_SIZE) uint8_t vm1_tx_buffer[PAGE_SIZE];
+
+/* Where the payload is built before being copied to the TX buffer */
+static uint8_t staging[FFA_PARTITION_MSG_PAYLOAD_MAX];
+
+static unsigned long long send_samples[IND_MSG_ITERATIONS];
+static unsigned long long cycle_samples[IND_MSG_ITERATIONS];
+
+/* Write the payload of message 'seq' and return the sum of its bytes. */
+static uint64_t ind_msg_fill(uint8_t *payload, size_t size, unsigned int seq)
+{
+	uint64_t sum = 0U;
+
+	for (size_t i = 0U; i < size; i++) {
+		payload[i] = (uint8_t)(i + seq);
+		sum += payload[i];
+	}
+
+	return sum;
+}
+
+static int ind_msg_measure(size_t size, bool in_place)
+{
+	unsigned long long start, t0, t1;
+	struct perf_stats stats;
+	struct ffa_value ret;
+	uint8_t *payload;
+	uint64_t sum;
+
+	start = syscounter_read();
+
+	for (unsigned int i = 0U; i < IND_MSG_ITERATIONS; i++) {
+		t0 = syscounter_read();
+
+		payload = indirect_message_tx_reserve(IND_MSG_SENDER,
+						      IND_MSG_RECEIVER,
+						      vm1_tx_buffer, size);
+		if (payload == NULL) {
+			return -1;
+		}
+
+		if (in_place) {
+			sum = ind_msg_fill(payload, size, i);
+		} else {
+			sum = ind_msg_fill(staging, size, i);
+			memcpy(payload, staging, size);
+		}
+
+		ret = ffa_msg_send2_with_id(0, IND_MSG_SENDER);
+		t1 = syscounter_read();
+
+		if (is_ffa_call_error(ret)) {
+			ERROR("FFA_MSG_SEND2 of message %u failed\n", i);
+			return -1;
+		}
+
+		ret = cactus_ind_msg_recv_cmd(HYP_ID, IND_MSG_RECEIVER,
+					      in_place);
+		cycle_samples[i] = syscounter_read() - t0;
+		send_samples[i] = t1 - t0;
+
+		if (!is_ffa_direct_response(ret) ||
+		    (cactus_get_response(ret) != CACTUS_SUCCESS) ||
+		    (cactus_ind_msg_recv_get_size(ret) != size) ||
+		    (cactus_ind_msg_recv_get_sum(ret) != sum) ||
+		    (cactus_ind_msg_recv_get_sender(ret) != IND_MSG_SENDER)) {
+			ERROR("SP didn't receive message %u as expected\n", i);
+			return -1;
+		}
+	}
+
+	tftf_testcase_printf("%zu bytes, %s: %llu messages/s\n", size,
+			     in_place ? "in place" : "copying",
+			     perf_ops_per_sec(IND_MSG_ITERATIONS,
+					      syscounter_read() - start));
+
+	perf_stats_compute(send_samples, IND_MSG_ITERATIONS, &stats);
+	perf_stats_print("  send", &stats);
+	perf_stats_compute(cycle_samples, IND_MSG_ITERATIONS, &stats);
+	perf_stats_print("  cycle", &stats);
+
+	return 0;
+}
+
+/*
+ * @Test_Aim@ Measure the rate of indirect messages from a VM to an SP, with
+ * and without copies of the payload
+ *
+ * For each payload size, send messages back to back from VM 1 to SP1, which
+ * consumes each of them before the next one is sent. Compare the latency of
+ * the send phase and of the whole cycle when the payload is copied and when
+ * it is built and parsed in place in the RX/TX buffers.
+ */
+test_result_t test_ffa_indirect_msg_throughput(void)
+{
+	test_result_t result = TEST_RESULT_SUCCESS;
+	struct mailbox_buffers mb;
+	struct ffa_value ret;
+
+	CHECK_SPMC_TESTING_SETUP(1, 2, expected_sp_uuids);
+	GET_TFTF_MAILBOX(mb);
+
+	ret = ffa_rxtx_map_forward(mb.send, IND_MSG_SENDER, vm1_rx_buffer,
+				   vm1_tx_buffer);
+	if (!is_expected_ffa_return(ret, FFA_SUCCESS_SMC32)) {
+		ERROR("Failed to map buffers RX %p TX %p for VM %x\n",
+		      vm1_rx_buffer, vm1_tx_buffer, IND_MSG_SENDER);
+		return TEST_RESULT_FAIL;
+	}
+
+	for (unsigned int i = 0U; i < ARRAY_SIZE(payload_sizes); i++) {
+		if ((ind_msg_measure(payload_sizes[i], false) != 0) ||
+		    (ind_msg_measure(payload_sizes[i], true) != 0)) {
+			result = TEST_RESULT_FAIL;
+			break;
+		}
+	}
+
+	ret = ffa_rxtx_unmap_with_id(IND_MSG_SENDER);
+	if (!is_expected_ffa_return(ret, FFA_SUCCESS_SMC32)) {
+		ERROR("Failed to unmap RXTX for vm %x\n", IND_MSG_SENDER);
+		return TEST_RESULT_FAIL;
+	}
+
+	return result;
+}
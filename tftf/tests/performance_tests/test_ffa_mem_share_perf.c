@@ -0,0 +1,712 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains benchmarks of the FF-A memory sharing ABIs between the
+ * normal world and a Secure Partition. Each cycle shares or lends a region to
+ * SP1, which retrieves and relinquishes it, and the region is then reclaimed.
+ * The cost of each phase is measured as a function of:
+ *  - the size of the region, from a page to hundreds of MiB;
+ *  - the number of constituents the region is split into;
+ *  - the number of fragments the transaction descriptor takes;
+ *  - the number of pages of the normal world RX/TX buffers;
+ *  - whether consecutive constituents are coalesced;
+ *  - the number of cores running cycles at the same time.
+ *
+ * The send and reclaim phases are timed by the normal world, the retrieve
+ * (including the FFA_MEM_FRAG_RX calls) and relinquish phases by the SP, which
+ * doesn't map nor access the region. Durations are reported in nanoseconds as
+ * percentiles of the samples, on one line per configuration so that the
+ * output of a test case fits in TESTCASE_OUTPUT_MAX_SIZE. Share and lend are
+ * measured by separate test cases. Donate is not measured, as a donated region
+ * can't be reclaimed to start the next cycle.
+ *
+ * The regions are taken from the spare normal world DRAM returned by
+ * plat_get_prot_regions(), which the tests are skipped without. Constituents
+ * are placed one constituent size apart, so that none of them are contiguous.
+ */
+
+#include <arch_helpers.h>
+#include <cactus_test_cmds.h>
+#include <debug.h>
+#include <events.h>
+#include <ffa_endpoints.h>
+#include <ffa_helpers.h>
+#include <plat_topology.h>
+#include <platform.h>
+#include <platform_def.h>
+#include <power_management.h>
+#include <psci.h>
+#include <spinlock.h>
+#include <spm_common.h>
+#include <spm_test_helpers.h>
+#include <stdbool.h>
+#include <string.h>
+#include <test_helpers.h>
+#include <tftf_lib.h>
+
+#include "perf_stats.h"
+
+#define MEM_PERF_RECEIVER		SP_ID(1)
+#define MEM_PERF_MAX_ITERATIONS		32U
+#define MEM_PERF_MAX_CONSTITUENTS	1024U
+
+/* Size of the region each core shares in the multi-core test */
+#define MEM_PERF_MC_SIZE		SZ_64K
+#define MEM_PERF_MC_ITERATIONS		MEM_PERF_MAX_ITERATIONS
+
+static const struct ffa_uuid expected_sp_uuids[] = {
+	{PRIMARY_UUID}, {SECONDARY_UUID}, {TERTIARY_UUID}
+};
+
+enum mem_perf_phase {
+	MEM_PERF_SEND = 0,
+	MEM_PERF_RETRIEVE,
+	MEM_PERF_RELINQUISH,
+	MEM_PERF_RECLAIM,
+	MEM_PERF_CYCLE,
+	MEM_PERF_PHASES
+};
+
+struct mem_perf_config {
+	size_t size;
+	uint32_t constituents;
+	unsigned int iterations;
+};
+
+/* Regions of a single constituent, of increasing sizes */
+static const struct mem_perf_config size_sweep[] = {
+	{ SZ_4K, 1U, MEM_PERF_MAX_ITERATIONS },
+	{ SZ_64K, 1U, MEM_PERF_MAX_ITERATIONS },
+	{ SZ_1M, 1U, MEM_PERF_MAX_ITERATIONS },
+	{ SZ_16M, 1U, 16U },
+	{ SZ_256M, 1U, 4U },
+};
+
+/* The same 1 MiB region, split into more and more constituents */
+static const struct mem_perf_config constituent_sweep[] = {
+	{ SZ_1M, 1U, MEM_PERF_MAX_ITERATIONS },
+	{ SZ_1M, 4U, MEM_PERF_MAX_ITERATIONS },
+	{ SZ_1M, 16U, MEM_PERF_MAX_ITERATIONS },
+	{ SZ_1M, 64U, MEM_PERF_MAX_ITERATIONS },
+	{ SZ_1M, 256U, MEM_PERF_MAX_ITERATIONS },
+};
+
+/*
+ * Single page constituents, enough of them for the descriptor to be split in
+ * several fragments of a page.
+ */
+static const struct mem_perf_config fragment_sweep[] = {
+	{ 128U * PAGE_SIZE, 128U, MEM_PERF_MAX_ITERATIONS },
+	{ 512U * PAGE_SIZE, 512U, MEM_PERF_MAX_ITERATIONS },
+	{ 1024U * PAGE_SIZE, 1024U, MEM_PERF_MAX_ITERATIONS },
+};
+
+static struct ffa_memory_region_constituent
+	constituents[MEM_PERF_MAX_CONSTITUENTS];
+static unsigned long long samples[MEM_PERF_PHASES][MEM_PERF_MAX_ITERATIONS];
+
+/* Serialise the use of the TX buffer, which all the cores share. */
+static spinlock_t tx_lock;
+
+/*
+ * Return the base of a spare normal world region of at least 'size' bytes, or
+ * 0 if the platform doesn't have any.
+ */
+static uintptr_t mem_perf_get_scratch(size_t size)
+{
+	const mem_region_t *regions;
+	int nelem = 0;
+
+	regions = plat_get_prot_regions(&nelem);
+
+	for (int i = 0; i < nelem; i++) {
+		if (regions[i].size >= size) {
+			return regions[i].addr;
+		}
+	}
+
+	return 0U;
+}
+
+/*
+ * Split 'size' bytes at 'base' into 'count' constituents of the same size,
+ * each of them followed by a gap of the same size.
+ */
+static void mem_perf_init_constituents(
+	struct ffa_memory_region_constituent *out, uintptr_t base,
+	size_t size, uint32_t count)
+{
+	uint32_t page_count = (size / PAGE_SIZE) / count;
+
+	for (uint32_t i = 0U; i < count; i++) {
+		out[i].address = (void *)(base + (2U * i * page_count *
+						  PAGE_SIZE));
+		out[i].page_count = page_count;
+		out[i].reserved = 0U;
+	}
+}
+
+/*
+ * Run one share or lend cycle of the region described by 'regions'. The
+ * duration of each phase is stored in 'ticks' and the number of fragments of
+ * the retrieve response in 'fragments'.
+ */
+static int mem_perf_cycle(struct mailbox_buffers *mb, uint32_t mem_func,
+			  const struct ffa_memory_region_constituent *regions,
+			  uint32_t count, unsigned long long *ticks,
+			  uint32_t *fragments)
+{
+	struct ffa_memory_access receiver =
+		ffa_memory_access_init_permissions_from_mem_func(
+			MEM_PERF_RECEIVER, mem_func);
+	ffa_memory_handle_t handle;
+	unsigned long long start, t0;
+	struct ffa_value ret;
+
+	start = syscounter_read();
+
+	spin_lock(&tx_lock);
+	handle = memory_init_and_send(mb->send, mb->size, HYP_ID, &receiver,
+				      1U, regions, count, mem_func, &ret);
+	spin_unlock(&tx_lock);
+
+	ticks[MEM_PERF_SEND] = syscounter_read() - start;
+
+	if (handle == FFA_MEMORY_HANDLE_INVALID) {
+		ERROR("Failed to send %u constituents\n", count);
+		return -1;
+	}
+
+	ret = cactus_mem_perf_send_cmd(HYP_ID, MEM_PERF_RECEIVER, mem_func,
+				       handle);
+	if (!is_ffa_direct_response(ret) ||
+	    (cactus_get_response(ret) != CACTUS_SUCCESS)) {
+		ERROR("SP failed to retrieve and relinquish the region\n");
+		/* Try to get the region back for the next tests. */
+		ffa_mem_reclaim(handle, 0U);
+		return -1;
+	}
+
+	ticks[MEM_PERF_RETRIEVE] = cactus_mem_perf_get_retrieve_ticks(ret);
+	ticks[MEM_PERF_RELINQUISH] = cactus_mem_perf_get_relinquish_ticks(ret);
+	*fragments = cactus_mem_perf_get_fragments(ret);
+
+	t0 = syscounter_read();
+	ret = ffa_mem_reclaim(handle, 0U);
+	ticks[MEM_PERF_RECLAIM] = syscounter_read() - t0;
+	ticks[MEM_PERF_CYCLE] = syscounter_read() - start;
+
+	if (is_ffa_call_error(ret)) {
+		ERROR("Failed to reclaim the region\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Run the cycles of 'config' from the calling core and print a line with the
+ * median of each phase, the median and 99th percentile of a full cycle and the
+ * median bandwidth of a full cycle.
+ */
+static int mem_perf_run_config(struct mailbox_buffers *mb, uint32_t mem_func,
+			       uintptr_t base,
+			       const struct mem_perf_config *config)
+{
+	unsigned long long ticks[MEM_PERF_PHASES];
+	unsigned long long p50[MEM_PERF_PHASES];
+	uint32_t fragments = 0U;
+	struct perf_stats stats;
+
+	mem_perf_init_constituents(constituents, base, config->size,
+				   config->constituents);
+
+	for (unsigned int i = 0U; i < config->iterations; i++) {
+		if (mem_perf_cycle(mb, mem_func, constituents,
+				   config->constituents, ticks,
+				   &fragments) != 0) {
+			return -1;
+		}
+
+		for (unsigned int p = 0U; p < MEM_PERF_PHASES; p++) {
+			samples[p][i] = ticks[p];
+		}
+	}
+
+	for (unsigned int p = 0U; p < MEM_PERF_PHASES; p++) {
+		perf_stats_compute(samples[p], config->iterations, &stats);
+		p50[p] = stats.p50;
+	}
+
+	/* 'stats' holds the percentiles of the full cycle */
+	tftf_testcase_printf("%7zu %4u %3u %8llu %8llu %8llu %8llu %8llu %8llu %5llu\n",
+			     config->size / SZ_1K, config->constituents,
+			     fragments, p50[MEM_PERF_SEND],
+			     p50[MEM_PERF_RETRIEVE], p50[MEM_PERF_RELINQUISH],
+			     p50[MEM_PERF_RECLAIM], stats.p50, stats.p99,
+			     (stats.p50 != 0U) ?
+			     ((unsigned long long)config->size * 1000U) /
+			     stats.p50 : 0U);
+
+	return 0;
+}
+
+static test_result_t mem_perf_sweep(const struct mem_perf_config *configs,
+				    unsigned int count, uint32_t mem_func)
+{
+	struct mailbox_buffers mb;
+	size_t span = 0U;
+	uintptr_t base;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sp_uuids);
+	GET_TFTF_MAILBOX(mb);
+
+	/* The constituents and their gaps take twice the size of the region */
+	for (unsigned int i = 0U; i < count; i++) {
+		if ((2U * configs[i].size) > span) {
+			span = 2U * configs[i].size;
+		}
+	}
+
+	base = mem_perf_get_scratch(span);
+	if (base == 0U) {
+		tftf_testcase_printf("No spare memory of %zu MiB\n",
+				     span / SZ_1M);
+		return TEST_RESULT_SKIPPED;
+	}
+
+	tftf_testcase_printf("%s, p50 of each phase and p50/p99 of a cycle in ns:\n",
+			     (mem_func == FFA_MEM_SHARE_SMC64) ? "Share" : "Lend");
+	tftf_testcase_printf("%7s %4s %3s %8s %8s %8s %8s %8s %8s %5s\n",
+			     "KiB", "cons", "frg", "send", "retrieve",
+			     "relinq", "reclaim", "cycle", "p99", "MB/s");
+
+	for (unsigned int i = 0U; i < count; i++) {
+		if (mem_perf_run_config(&mb, mem_func, base,
+					&configs[i]) != 0) {
+			return TEST_RESULT_FAIL;
+		}
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Measure the cost of sharing a region as a function of its size
+ *
+ * Regions made of a single constituent, from 4 KiB to 256 MiB, are shared
+ * with SP1 from the lead CPU.
+ */
+test_result_t test_ffa_mem_share_perf_size(void)
+{
+	return mem_perf_sweep(size_sweep, ARRAY_SIZE(size_sweep),
+			      FFA_MEM_SHARE_SMC64);
+}
+
+/*
+ * @Test_Aim@ Measure the cost of lending a region as a function of its size
+ *
+ * Same as test_ffa_mem_share_perf_size(), with FFA_MEM_LEND.
+ */
+test_result_t test_ffa_mem_lend_perf_size(void)
+{
+	return mem_perf_sweep(size_sweep, ARRAY_SIZE(size_sweep),
+			      FFA_MEM_LEND_SMC64);
+}
+
+/*
+ * @Test_Aim@ Measure the cost of sharing a region as a function of the number
+ * of its constituents
+ *
+ * A 1 MiB region is split into up to 256 non-contiguous constituents.
+ */
+test_result_t test_ffa_mem_share_perf_constituents(void)
+{
+	return mem_perf_sweep(constituent_sweep, ARRAY_SIZE(constituent_sweep),
+			      FFA_MEM_SHARE_SMC64);
+}
+
+/*
+ * @Test_Aim@ Measure the cost of lending a region as a function of the number
+ * of its constituents
+ *
+ * Same as test_ffa_mem_share_perf_constituents(), with FFA_MEM_LEND.
+ */
+test_result_t test_ffa_mem_lend_perf_constituents(void)
+{
+	return mem_perf_sweep(constituent_sweep, ARRAY_SIZE(constituent_sweep),
+			      FFA_MEM_LEND_SMC64);
+}
+
+/*
+ * @Test_Aim@ Measure the cost of sharing a region as a function of the number
+ * of fragments of its descriptors
+ *
+ * Regions of up to 1024 single page constituents are sent in several
+ * fragments of a page, and retrieved by the SP in as many fragments.
+ */
+test_result_t test_ffa_mem_share_perf_fragments(void)
+{
+	return mem_perf_sweep(fragment_sweep, ARRAY_SIZE(fragment_sweep),
+			      FFA_MEM_SHARE_SMC64);
+}
+
+/*
+ * @Test_Aim@ Measure the cost of lending a region as a function of the number
+ * of fragments of its descriptors
+ *
+ * Same as test_ffa_mem_share_perf_fragments(), with FFA_MEM_LEND.
+ */
+test_result_t test_ffa_mem_lend_perf_fragments(void)
+{
+	return mem_perf_sweep(fragment_sweep, ARRAY_SIZE(fragment_sweep),
+			      FFA_MEM_LEND_SMC64);
+}
+
+/* Descriptor of the largest region which fits in the mailbox page sweep */
+#define MEM_PERF_MB_CONSTITUENTS	MEM_PERF_MAX_CONSTITUENTS
+
+static uint8_t frag_scratch[TFTF_MAILBOX_MAX_PAGES * PAGE_SIZE];
+
+/*
+ * Return the number of fragments the descriptor of 'count' constituents takes
+ * when sent from a TX buffer of 'size' bytes, by building it the same way
+ * memory_init_and_send() does, in a scratch buffer.
+ */
+static uint32_t mem_perf_send_fragments(uint32_t mem_func, size_t size,
+					const struct ffa_memory_region_constituent *regions,
+					uint32_t count)
+{
+	struct ffa_memory_access receiver =
+		ffa_memory_access_init_permissions_from_mem_func(
+			MEM_PERF_RECEIVER, mem_func);
+	enum ffa_memory_type type = (mem_func != FFA_MEM_SHARE_SMC64)
+					    ? FFA_MEMORY_NOT_SPECIFIED_MEM
+					    : FFA_MEMORY_NORMAL_MEM;
+	uint32_t total_length, fragment_length;
+	uint32_t remaining, fragments = 1U;
+
+	remaining = ffa_memory_region_init(
+		(struct ffa_memory_region *)frag_scratch, size, HYP_ID,
+		&receiver, 1U, regions, count, 0, 0, type,
+		FFA_MEMORY_CACHE_WRITE_BACK, FFA_MEMORY_INNER_SHAREABLE,
+		&total_length, &fragment_length);
+
+	while (remaining != 0U) {
+		remaining = ffa_memory_fragment_init(
+			(struct ffa_memory_region_constituent *)frag_scratch,
+			size, regions + count - remaining, remaining,
+			&fragment_length);
+		fragments++;
+	}
+
+	return fragments;
+}
+
+/*
+ * @Test_Aim@ Measure the cost of sharing a region as a function of the size
+ * of the normal world RX/TX buffers
+ *
+ * The TFTF mailbox is remapped with buffers of 1 to TFTF_MAILBOX_MAX_PAGES
+ * pages, and a region of 1024 single page constituents is shared with SP1
+ * from each of them. Report the number of fragments the descriptor is sent
+ * in and the cycle latency. Buffer sizes the SPMC rejects are skipped, and
+ * the mailbox is mapped back with a single page at the end.
+ */
+test_result_t test_ffa_mem_share_perf_mailbox_pages(void)
+{
+	unsigned long long ticks[MEM_PERF_PHASES];
+	struct mailbox_buffers mb;
+	struct perf_stats stats;
+	uint32_t fragments;
+	test_result_t result = TEST_RESULT_SUCCESS;
+	uintptr_t base;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sp_uuids);
+
+	base = mem_perf_get_scratch(2U * MEM_PERF_MB_CONSTITUENTS * PAGE_SIZE);
+	if (base == 0U) {
+		tftf_testcase_printf("No spare memory for %u pages\n",
+				     2U * MEM_PERF_MB_CONSTITUENTS);
+		return TEST_RESULT_SKIPPED;
+	}
+
+	mem_perf_init_constituents(constituents, base,
+				   MEM_PERF_MB_CONSTITUENTS * PAGE_SIZE,
+				   MEM_PERF_MB_CONSTITUENTS);
+
+	for (uint32_t pages = 1U; pages <= TFTF_MAILBOX_MAX_PAGES;
+	     pages *= 2U) {
+		if (!configure_tftf_mailbox(pages)) {
+			tftf_testcase_printf("%u page mailbox: not supported\n",
+					     pages);
+			continue;
+		}
+
+		GET_TFTF_MAILBOX(mb);
+
+		for (unsigned int i = 0U; i < MEM_PERF_MAX_ITERATIONS; i++) {
+			if (mem_perf_cycle(&mb, FFA_MEM_SHARE_SMC64,
+					   constituents,
+					   MEM_PERF_MB_CONSTITUENTS, ticks,
+					   &fragments) != 0) {
+				result = TEST_RESULT_FAIL;
+				break;
+			}
+			samples[MEM_PERF_CYCLE][i] = ticks[MEM_PERF_CYCLE];
+		}
+
+		if (result != TEST_RESULT_SUCCESS) {
+			break;
+		}
+
+		tftf_testcase_printf("%u page mailbox: %u fragments sent\n",
+				     pages,
+				     mem_perf_send_fragments(
+					     FFA_MEM_SHARE_SMC64, mb.size,
+					     constituents,
+					     MEM_PERF_MB_CONSTITUENTS));
+		perf_stats_compute(samples[MEM_PERF_CYCLE],
+				   MEM_PERF_MAX_ITERATIONS, &stats);
+		perf_stats_print("  cycle", &stats);
+	}
+
+	if (!configure_tftf_mailbox(1U)) {
+		ERROR("Failed to map back the mailbox\n");
+		result = TEST_RESULT_FAIL;
+	}
+
+	return result;
+}
+
+/*
+ * @Test_Aim@ Measure the gain of coalescing the constituents of a region
+ *
+ * A 4 MiB region is described as 1024 consecutive single page constituents,
+ * as a list of scattered pages would be, and shared with SP1 as it is, then
+ * after ffa_memory_constituents_coalesce() has merged them. Report the
+ * constituent and fragment counts, and the cycle latency of both.
+ */
+test_result_t test_ffa_mem_share_perf_coalesce(void)
+{
+	unsigned long long ticks[MEM_PERF_PHASES];
+	struct mailbox_buffers mb;
+	struct perf_stats stats;
+	uint32_t count = MEM_PERF_MAX_CONSTITUENTS;
+	uint32_t fragments;
+	uintptr_t base;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sp_uuids);
+	GET_TFTF_MAILBOX(mb);
+
+	base = mem_perf_get_scratch(MEM_PERF_MAX_CONSTITUENTS * PAGE_SIZE);
+	if (base == 0U) {
+		tftf_testcase_printf("No spare memory for %u pages\n",
+				     MEM_PERF_MAX_CONSTITUENTS);
+		return TEST_RESULT_SKIPPED;
+	}
+
+	for (uint32_t i = 0U; i < count; i++) {
+		constituents[i].address = (void *)(base + (i * PAGE_SIZE));
+		constituents[i].page_count = 1U;
+		constituents[i].reserved = 0U;
+	}
+
+	for (unsigned int pass = 0U; pass < 2U; pass++) {
+		if (pass == 1U) {
+			count = ffa_memory_constituents_coalesce(constituents,
+								 count);
+		}
+
+		for (unsigned int i = 0U; i < MEM_PERF_MAX_ITERATIONS; i++) {
+			if (mem_perf_cycle(&mb, FFA_MEM_SHARE_SMC64,
+					   constituents, count, ticks,
+					   &fragments) != 0) {
+				return TEST_RESULT_FAIL;
+			}
+			samples[MEM_PERF_CYCLE][i] = ticks[MEM_PERF_CYCLE];
+		}
+
+		tftf_testcase_printf("%s: %u constituents, %u fragments sent\n",
+				     (pass == 0U) ? "Verbatim" : "Coalesced",
+				     count,
+				     mem_perf_send_fragments(
+					     FFA_MEM_SHARE_SMC64, mb.size,
+					     constituents, count));
+		perf_stats_compute(samples[MEM_PERF_CYCLE],
+				   MEM_PERF_MAX_ITERATIONS, &stats);
+		perf_stats_print("  cycle", &stats);
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * Cycles of all the cores at once.
+ *
+ * Every core is powered on and waits for the lead CPU to set mc_go, then
+ * shares its own slice of the scratch memory in a loop.
+ */
+static volatile bool mc_go;
+static volatile bool mc_failed;
+static uintptr_t mc_base;
+static bool mc_cpu[PLATFORM_CORE_COUNT];
+static unsigned long long mc_samples[PLATFORM_CORE_COUNT][MEM_PERF_MC_ITERATIONS];
+static unsigned long long mc_start[PLATFORM_CORE_COUNT];
+static unsigned long long mc_end[PLATFORM_CORE_COUNT];
+static event_t mc_ready[PLATFORM_CORE_COUNT];
+static event_t mc_done[PLATFORM_CORE_COUNT];
+
+static void mem_perf_mc_run(unsigned int core_pos)
+{
+	struct ffa_memory_region_constituent region;
+	unsigned long long ticks[MEM_PERF_PHASES];
+	struct mailbox_buffers mb;
+	uint32_t fragments;
+
+	while (!mc_go)
+		;
+
+	if (!get_tftf_mailbox(&mb)) {
+		mc_failed = true;
+		return;
+	}
+
+	mem_perf_init_constituents(&region,
+				   mc_base + (core_pos * MEM_PERF_MC_SIZE),
+				   MEM_PERF_MC_SIZE, 1U);
+
+	mc_start[core_pos] = syscounter_read();
+
+	for (unsigned int i = 0U; i < MEM_PERF_MC_ITERATIONS; i++) {
+		if (mem_perf_cycle(&mb, FFA_MEM_SHARE_SMC64, &region, 1U,
+				   ticks, &fragments) != 0) {
+			mc_failed = true;
+			return;
+		}
+		mc_samples[core_pos][i] = ticks[MEM_PERF_CYCLE];
+	}
+
+	mc_end[core_pos] = syscounter_read();
+}
+
+static test_result_t mem_perf_mc_worker(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	tftf_send_event(&mc_ready[core_pos]);
+	mem_perf_mc_run(core_pos);
+	tftf_send_event(&mc_done[core_pos]);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Measure the aggregate rate of memory sharing cycles run by all
+ * the cores concurrently
+ *
+ * Every core shares its own 64 KiB region with SP1 in a loop. The normal
+ * world serialises the use of its TX buffer, and SP1 the use of its mailbox,
+ * so this mostly shows how the SPMC scales with concurrent transactions.
+ * Report the cycle latency percentiles of all the cores and the aggregate
+ * cycle rate from the first send to the last reclaim.
+ */
+test_result_t test_ffa_mem_share_perf_all_cpus(void)
+{
+	u_register_t lead_mpid = read_mpidr_el1() & MPID_MASK;
+	unsigned int lead_pos = platform_get_core_pos(lead_mpid);
+	unsigned long long first_start = ~0ULL, last_end = 0U;
+	unsigned int cpu_node, core_pos, num_cpus = 0U;
+	struct perf_stats stats;
+	u_register_t mpidr;
+	int ret;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sp_uuids);
+
+	mc_base = mem_perf_get_scratch(PLATFORM_CORE_COUNT * MEM_PERF_MC_SIZE);
+	if (mc_base == 0U) {
+		tftf_testcase_printf("No spare memory for %u cores\n",
+				     PLATFORM_CORE_COUNT);
+		return TEST_RESULT_SKIPPED;
+	}
+
+	mc_go = false;
+	mc_failed = false;
+	memset(mc_cpu, 0, sizeof(mc_cpu));
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		tftf_init_event(&mc_ready[i]);
+		tftf_init_event(&mc_done[i]);
+	}
+
+	for_each_cpu(cpu_node) {
+		mpidr = tftf_get_mpidr_from_node(cpu_node);
+		core_pos = platform_get_core_pos(mpidr);
+
+		if (mpidr != lead_mpid) {
+			ret = tftf_cpu_on(mpidr, (uintptr_t)mem_perf_mc_worker,
+					  0U);
+			if (ret != PSCI_E_SUCCESS) {
+				ERROR("tftf_cpu_on mpidr 0x%llx returns %d\n",
+				      (unsigned long long)mpidr, ret);
+				mc_failed = true;
+				break;
+			}
+			tftf_wait_for_event(&mc_ready[core_pos]);
+		}
+
+		mc_cpu[core_pos] = true;
+	}
+
+	/* Release the cores which are online, even if some failed to start */
+	dsbish();
+	mc_go = true;
+	dsbish();
+	sev();
+
+	if (!mc_failed) {
+		mem_perf_mc_run(lead_pos);
+	}
+
+	for (core_pos = 0U; core_pos < PLATFORM_CORE_COUNT; core_pos++) {
+		if (mc_cpu[core_pos] && (core_pos != lead_pos)) {
+			tftf_wait_for_event(&mc_done[core_pos]);
+		}
+	}
+
+	if (mc_failed) {
+		return TEST_RESULT_FAIL;
+	}
+
+	/* Gather the samples of all the cores at the start of the array */
+	for (core_pos = 0U; core_pos < PLATFORM_CORE_COUNT; core_pos++) {
+		if (!mc_cpu[core_pos]) {
+			continue;
+		}
+
+		if (mc_start[core_pos] < first_start) {
+			first_start = mc_start[core_pos];
+		}
+		if (mc_end[core_pos] > last_end) {
+			last_end = mc_end[core_pos];
+		}
+
+		if (num_cpus != core_pos) {
+			memcpy(mc_samples[num_cpus], mc_samples[core_pos],
+			       sizeof(mc_samples[core_pos]));
+		}
+		num_cpus++;
+	}
+
+	perf_stats_compute(&mc_samples[0][0],
+			   num_cpus * MEM_PERF_MC_ITERATIONS, &stats);
+	perf_stats_print("Share cycle, all cores", &stats);
+	tftf_testcase_printf("%u cores: %llu cycles/s\n", num_cpus,
+			     perf_ops_per_sec(num_cpus * MEM_PERF_MC_ITERATIONS,
+					      last_end - first_start));
+
+	return TEST_RESULT_SUCCESS;
+}
@@ -0,0 +1,721 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains benchmarks of the FF-A notifications, with SP1 as the
+ * receiver:
+ *  - the latency of each step of the signalling of a notification:
+ *    FFA_NOTIFICATION_SET, delivery of the Schedule Receiver Interrupt (SRI)
+ *    to the normal world, FFA_NOTIFICATION_INFO_GET, delivery of the
+ *    Notification Pending Interrupt (NPI) to the receiver and
+ *    FFA_NOTIFICATION_GET, for global and per-vCPU notifications;
+ *  - the cost of setting and getting notifications as the number of bound
+ *    senders grows;
+ *  - the cost of FFA_NOTIFICATION_INFO_GET as the number of receivers with
+ *    pending notifications grows;
+ *  - the aggregate rate of set/get cycles run by all the cores at once.
+ *
+ * The receiver gets its notifications when it is sent a direct request, so
+ * the get step includes the round trip of that request, and the NPI delivery
+ * is measured from the start of the request to the entry of the NPI handler
+ * of the SP. SPs are asked to set notifications with the SRI delayed, so that
+ * they are not preempted by it.
+ */
+
+#include <arch_helpers.h>
+#include <cactus_test_cmds.h>
+#include <debug.h>
+#include <events.h>
+#include <ffa_endpoints.h>
+#include <ffa_helpers.h>
+#include <irq.h>
+#include <plat_topology.h>
+#include <platform.h>
+#include <platform_def.h>
+#include <power_management.h>
+#include <psci.h>
+#include <spm_common.h>
+#include <spm_test_helpers.h>
+#include <stdbool.h>
+#include <string.h>
+#include <test_helpers.h>
+#include <tftf_lib.h>
+
+#include "perf_stats.h"
+
+#define NOTIF_ITERATIONS		128U
+#define NOTIF_RECEIVER			SP_ID(1)
+
+/* Largest number of senders bound to, or receivers signalled by, SP1 */
+#define NOTIF_MAX_SENDERS		16U
+#define NOTIF_MAX_RECEIVERS		8U
+
+/* VM using the notification 'n', from VM1 onwards */
+#define VM_ID_OF(n)			VM_ID(((n) + 1U))
+
+/* Each core of the multi-core test sets its own notification */
+CASSERT(PLATFORM_CORE_COUNT <= MAX_FFA_NOTIFICATIONS,
+	assert_too_many_cores_for_notifications);
+
+static const struct ffa_uuid expected_sp_uuids[] = {
+	{PRIMARY_UUID}, {SECONDARY_UUID}, {TERTIARY_UUID}
+};
+
+enum notif_phase {
+	NOTIF_SET = 0,
+	NOTIF_SRI,
+	NOTIF_INFO_GET,
+	NOTIF_NPI,
+	NOTIF_GET,
+	NOTIF_TOTAL,
+	NOTIF_PHASES
+};
+
+struct notif_config {
+	const char *name;
+	ffa_id_t sender;
+	bool per_vcpu;
+};
+
+static const struct notif_config latency_configs[] = {
+	{ "VM1 -> SP1, global", VM_ID(1), false },
+	{ "SP2 -> SP1, global", SP_ID(2), false },
+	{ "SP2 -> SP1, per-vCPU", SP_ID(2), true },
+};
+
+static unsigned long long samples[NOTIF_PHASES][NOTIF_ITERATIONS];
+static unsigned long long sri_cnt[PLATFORM_CORE_COUNT];
+
+static int sri_handler(void *data)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	sri_cnt[core_pos] = syscounter_read();
+
+	return 0;
+}
+
+static bool sri_handler_register(void)
+{
+	if (tftf_irq_register_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID,
+				      sri_handler) != 0) {
+		ERROR("Failed to register the SRI handler\n");
+		return false;
+	}
+
+	return true;
+}
+
+static bool notif_bind(ffa_id_t sender, ffa_notification_bitmap_t bitmap,
+		       bool per_vcpu)
+{
+	struct ffa_value ret;
+
+	ret = cactus_notification_bind_send_cmd(
+		HYP_ID, NOTIF_RECEIVER, NOTIF_RECEIVER, sender, bitmap,
+		per_vcpu ? FFA_NOTIFICATIONS_FLAG_PER_VCPU : 0U);
+
+	return is_ffa_direct_response(ret) &&
+	       (cactus_get_response(ret) == CACTUS_SUCCESS);
+}
+
+static bool notif_unbind(ffa_id_t sender, ffa_notification_bitmap_t bitmap)
+{
+	struct ffa_value ret;
+
+	ret = cactus_notification_unbind_send_cmd(HYP_ID, NOTIF_RECEIVER,
+						  NOTIF_RECEIVER, sender,
+						  bitmap);
+
+	return is_ffa_direct_response(ret) &&
+	       (cactus_get_response(ret) == CACTUS_SUCCESS);
+}
+
+/*
+ * Set 'bitmap' from 'sender' to 'receiver', directly for a VM or through a
+ * request to the sender for an SP.
+ */
+static bool notif_set(ffa_id_t sender, ffa_id_t receiver,
+		      ffa_notification_bitmap_t bitmap, bool per_vcpu,
+		      unsigned int vcpu)
+{
+	uint32_t flags = per_vcpu ? (FFA_NOTIFICATIONS_FLAG_PER_VCPU |
+				     FFA_NOTIFICATIONS_FLAGS_VCPU_ID(vcpu)) :
+				    0U;
+	struct ffa_value ret;
+
+	if (!IS_SP_ID(sender)) {
+		ret = ffa_notification_set(sender, receiver, flags, bitmap);
+		return !is_ffa_call_error(ret);
+	}
+
+	ret = cactus_notifications_set_send_cmd(
+		HYP_ID, sender, receiver, sender,
+		flags | FFA_NOTIFICATIONS_FLAG_DELAY_SRI, bitmap, 0);
+
+	return is_ffa_direct_response(ret) &&
+	       (cactus_get_response(ret) == CACTUS_SUCCESS);
+}
+
+/*
+ * Request SP1 to get its notifications pending for 'vcpu' and return the
+ * ones set by VMs or by SPs, depending on 'from_sp', in 'bitmap'.
+ */
+static bool notif_get(bool from_sp, unsigned int vcpu,
+		      ffa_notification_bitmap_t *bitmap)
+{
+	struct ffa_value ret;
+
+	ret = cactus_notification_get_send_cmd(
+		HYP_ID, NOTIF_RECEIVER, NOTIF_RECEIVER, vcpu,
+		from_sp ? FFA_NOTIFICATIONS_FLAG_BITMAP_SP :
+			  FFA_NOTIFICATIONS_FLAG_BITMAP_VM, false);
+
+	if (!is_ffa_direct_response(ret) ||
+	    (cactus_get_response(ret) != CACTUS_SUCCESS)) {
+		return false;
+	}
+
+	*bitmap = from_sp ? cactus_notifications_get_from_sp(ret) :
+			    cactus_notifications_get_from_vm(ret);
+
+	return true;
+}
+
+/*
+ * Return the system counter value at which SP1 entered its NPI handler on the
+ * calling core, or 0 if the last interrupt it handled wasn't the NPI.
+ */
+static unsigned long long notif_npi_cnt(void)
+{
+	struct ffa_value ret;
+
+	ret = cactus_get_last_interrupt_latency_cmd(HYP_ID, NOTIF_RECEIVER);
+	if (!is_ffa_direct_response(ret) ||
+	    (cactus_get_interrupt_id(ret) !=
+	     NOTIFICATION_PENDING_INTERRUPT_INTID)) {
+		return 0U;
+	}
+
+	return cactus_get_interrupt_handled_cnt(ret);
+}
+
+static int notif_measure_latency(const struct notif_config *config)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	const ffa_notification_bitmap_t bitmap = FFA_NOTIFICATION(10);
+	const bool from_sp = IS_SP_ID(config->sender);
+	unsigned long long t0, t1, t2, t3, t4, npi;
+	unsigned int npi_count = 0U;
+	unsigned long long p50[NOTIF_PHASES], total_p99 = 0U;
+	ffa_notification_bitmap_t got;
+	struct perf_stats stats;
+	struct ffa_value ret;
+	int result = -1;
+
+	if (!notif_bind(config->sender, bitmap, config->per_vcpu)) {
+		tftf_testcase_printf("%s: not supported\n", config->name);
+		return 0;
+	}
+
+	for (unsigned int i = 0U; i < NOTIF_ITERATIONS; i++) {
+		sri_cnt[core_pos] = 0U;
+
+		t0 = syscounter_read();
+		if (!notif_set(config->sender, NOTIF_RECEIVER, bitmap,
+			       config->per_vcpu, core_pos)) {
+			ERROR("%s: failed to set notification %u\n",
+			      config->name, i);
+			goto out;
+		}
+		t1 = syscounter_read();
+
+		/*
+		 * Wait for the SRI, if it was delayed to the end of the set.
+		 * Fail the test if it doesn't come within a second.
+		 */
+		while (sri_cnt[core_pos] == 0U) {
+			if ((syscounter_read() - t1) >= read_cntfrq_el0()) {
+				ERROR("%s: no SRI for notification %u\n",
+				      config->name, i);
+				goto out;
+			}
+		}
+
+		t2 = syscounter_read();
+		ret = ffa_notification_info_get();
+		t3 = syscounter_read();
+
+		if (is_ffa_call_error(ret)) {
+			ERROR("%s: no pending notification info\n",
+			      config->name);
+			goto out;
+		}
+
+		if (!notif_get(from_sp, core_pos, &got) || (got != bitmap)) {
+			ERROR("%s: failed to get notification %u\n",
+			      config->name, i);
+			goto out;
+		}
+		t4 = syscounter_read();
+
+		samples[NOTIF_SET][i] = t1 - t0;
+		samples[NOTIF_INFO_GET][i] = t3 - t2;
+		samples[NOTIF_GET][i] = t4 - t3;
+		samples[NOTIF_TOTAL][i] = t4 - t0;
+		samples[NOTIF_SRI][i] = sri_cnt[core_pos] - t0;
+
+		npi = notif_npi_cnt();
+		if (npi > t3) {
+			samples[NOTIF_NPI][npi_count++] = npi - t3;
+		}
+	}
+
+	for (unsigned int p = 0U; p < NOTIF_PHASES; p++) {
+		unsigned int count = (p == NOTIF_NPI) ? npi_count :
+							NOTIF_ITERATIONS;
+
+		if (count == 0U) {
+			p50[p] = 0U;
+			continue;
+		}
+
+		perf_stats_compute(samples[p], count, &stats);
+		p50[p] = stats.p50;
+		if (p == NOTIF_TOTAL) {
+			total_p99 = stats.p99;
+		}
+	}
+
+	tftf_testcase_printf("%-20s %5llu %5llu %5llu %5llu %5llu %6llu %6llu %3u\n",
+			     config->name, p50[NOTIF_SET], p50[NOTIF_SRI],
+			     p50[NOTIF_INFO_GET], p50[NOTIF_NPI],
+			     p50[NOTIF_GET], p50[NOTIF_TOTAL], total_p99,
+			     npi_count);
+
+	result = 0;
+
+out:
+	if (!notif_unbind(config->sender, bitmap)) {
+		ERROR("%s: failed to unbind\n", config->name);
+		result = -1;
+	}
+
+	return result;
+}
+
+/*
+ * @Test_Aim@ Measure the latency of each step of the signalling of a
+ * notification to an SP
+ *
+ * SP1 binds a notification to VM1, then to SP2 as a global and as a per-vCPU
+ * notification, which is set and got in a loop from the lead CPU. Per-vCPU
+ * notifications are skipped if the SPMC rejects their binding.
+ */
+test_result_t test_ffa_notifications_latency(void)
+{
+	test_result_t result = TEST_RESULT_SUCCESS;
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+
+	if (!sri_handler_register()) {
+		return TEST_RESULT_FAIL;
+	}
+
+	tftf_testcase_printf("p50 ns per step, p50/p99 ns in total, NPIs of %u\n",
+			     NOTIF_ITERATIONS);
+	tftf_testcase_printf("%-20s %5s %5s %5s %5s %5s %6s %6s %3s\n", "",
+			     "set", "SRI", "info", "NPI", "get", "total", "p99",
+			     "#");
+
+	for (unsigned int i = 0U; i < ARRAY_SIZE(latency_configs); i++) {
+		if (notif_measure_latency(&latency_configs[i]) != 0) {
+			result = TEST_RESULT_FAIL;
+			break;
+		}
+	}
+
+	tftf_irq_unregister_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID);
+
+	return result;
+}
+
+/*
+ * @Test_Aim@ Measure the cost of setting and getting notifications as the
+ * number of senders bound to the receiver grows
+ *
+ * SP1 binds a different global notification to each of up to 16 VMs. In each
+ * iteration, every VM sets its notification and SP1 gets all of them at once.
+ * Report the time taken by all the senders to set their notification, and by
+ * the receiver to get them.
+ */
+test_result_t test_ffa_notifications_senders_scaling(void)
+{
+	test_result_t result = TEST_RESULT_SUCCESS;
+	ffa_notification_bitmap_t all, got;
+	unsigned int bound = 0U;
+	unsigned long long t0, t1, t2;
+	struct perf_stats stats;
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+
+	if (!sri_handler_register()) {
+		return TEST_RESULT_FAIL;
+	}
+
+	for (unsigned int senders = 1U; senders <= NOTIF_MAX_SENDERS;
+	     senders *= 2U) {
+		for (; bound < senders; bound++) {
+			if (!notif_bind(VM_ID_OF(bound),
+					FFA_NOTIFICATION(bound), false)) {
+				ERROR("Failed to bind VM %u\n", bound + 1U);
+				result = TEST_RESULT_FAIL;
+				goto out;
+			}
+		}
+
+		all = (1ULL << senders) - 1U;
+
+		for (unsigned int i = 0U; i < NOTIF_ITERATIONS; i++) {
+			t0 = syscounter_read();
+			for (unsigned int s = 0U; s < senders; s++) {
+				if (!notif_set(VM_ID_OF(s), NOTIF_RECEIVER,
+					       FFA_NOTIFICATION(s), false,
+					       0U)) {
+					result = TEST_RESULT_FAIL;
+					goto out;
+				}
+			}
+			t1 = syscounter_read();
+
+			if (!notif_get(false, 0U, &got) || (got != all)) {
+				ERROR("Got notifications %llx instead of %llx\n",
+				      (unsigned long long)got,
+				      (unsigned long long)all);
+				result = TEST_RESULT_FAIL;
+				goto out;
+			}
+			t2 = syscounter_read();
+
+			samples[NOTIF_SET][i] = t1 - t0;
+			samples[NOTIF_GET][i] = t2 - t1;
+		}
+
+		tftf_testcase_printf("%u senders:\n", senders);
+		perf_stats_compute(samples[NOTIF_SET], NOTIF_ITERATIONS, &stats);
+		perf_stats_print("  set by all", &stats);
+		perf_stats_compute(samples[NOTIF_GET], NOTIF_ITERATIONS, &stats);
+		perf_stats_print("  get", &stats);
+	}
+
+out:
+	for (unsigned int s = 0U; s < bound; s++) {
+		if (!notif_unbind(VM_ID_OF(s), FFA_NOTIFICATION(s))) {
+			result = TEST_RESULT_FAIL;
+		}
+	}
+
+	tftf_irq_unregister_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID);
+
+	return result;
+}
+
+/*
+ * @Test_Aim@ Measure the cost of FFA_NOTIFICATION_INFO_GET as the number of
+ * receivers with pending notifications grows
+ *
+ * Up to 8 VMs create their notifications bitmap and bind a notification to
+ * SP1, which sets them all. Time FFA_NOTIFICATION_INFO_GET, whose list of IDs
+ * grows with the number of receivers, before the VMs get their notification.
+ */
+test_result_t test_ffa_notifications_info_get_scaling(void)
+{
+	test_result_t result = TEST_RESULT_SUCCESS;
+	const ffa_notification_bitmap_t bitmap = FFA_NOTIFICATION(20);
+	unsigned int created = 0U;
+	unsigned long long t0;
+	struct perf_stats stats;
+	struct ffa_value ret;
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+
+	if (!sri_handler_register()) {
+		return TEST_RESULT_FAIL;
+	}
+
+	for (unsigned int receivers = 1U; receivers <= NOTIF_MAX_RECEIVERS;
+	     receivers *= 2U) {
+		for (; created < receivers; created++) {
+			ffa_id_t vm_id = VM_ID_OF(created);
+
+			ret = ffa_notification_bitmap_create(vm_id, 1U);
+			if (is_ffa_call_error(ret)) {
+				tftf_testcase_printf("%u receivers: not supported\n",
+						     receivers);
+				goto out;
+			}
+
+			ret = ffa_notification_bind(NOTIF_RECEIVER, vm_id, 0U,
+						    bitmap);
+			if (is_ffa_call_error(ret)) {
+				ffa_notification_bitmap_destroy(vm_id);
+				result = TEST_RESULT_FAIL;
+				goto out;
+			}
+		}
+
+		for (unsigned int i = 0U; i < NOTIF_ITERATIONS; i++) {
+			for (unsigned int r = 0U; r < receivers; r++) {
+				if (!notif_set(NOTIF_RECEIVER, VM_ID_OF(r),
+					       bitmap, false, 0U)) {
+					result = TEST_RESULT_FAIL;
+					goto out;
+				}
+			}
+
+			t0 = syscounter_read();
+			ret = ffa_notification_info_get();
+			samples[NOTIF_INFO_GET][i] = syscounter_read() - t0;
+
+			if (is_ffa_call_error(ret) ||
+			    (ffa_notification_info_get_lists_count(ret) !=
+			     receivers)) {
+				ERROR("Unexpected notification info\n");
+				dump_ffa_value(ret);
+				result = TEST_RESULT_FAIL;
+				goto out;
+			}
+
+			for (unsigned int r = 0U; r < receivers; r++) {
+				ret = ffa_notification_get(
+					VM_ID_OF(r), 0U,
+					FFA_NOTIFICATIONS_FLAG_BITMAP_SP);
+				if (is_ffa_call_error(ret) ||
+				    (ffa_notification_get_from_sp(ret) !=
+				     bitmap)) {
+					result = TEST_RESULT_FAIL;
+					goto out;
+				}
+			}
+		}
+
+		tftf_testcase_printf("%u receivers pending:\n", receivers);
+		perf_stats_compute(samples[NOTIF_INFO_GET], NOTIF_ITERATIONS,
+				   &stats);
+		perf_stats_print("  info get", &stats);
+	}
+
+out:
+	for (unsigned int r = 0U; r < created; r++) {
+		ffa_id_t vm_id = VM_ID_OF(r);
+
+		/* Drop what a failed iteration may have left pending */
+		ffa_notification_get(vm_id, 0U,
+				     FFA_NOTIFICATIONS_FLAG_BITMAP_SP);
+
+		if (is_ffa_call_error(ffa_notification_unbind(NOTIF_RECEIVER,
+							      vm_id,
+							      bitmap)) ||
+		    is_ffa_call_error(ffa_notification_bitmap_destroy(vm_id))) {
+			result = TEST_RESULT_FAIL;
+		}
+	}
+
+	tftf_irq_unregister_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID);
+
+	return result;
+}
+
+/*
+ * Set/get cycles of all the cores at once.
+ *
+ * Every core is powered on and waits for the lead CPU to set mc_go. Core N
+ * sets the global notification N, as VM N + 1, then requests SP1 to get the
+ * notifications from VMs on the same core. A core may get the notifications
+ * set by other cores, so only the success of the calls is checked.
+ */
+static volatile bool mc_go;
+static volatile bool mc_failed;
+static bool mc_cpu[PLATFORM_CORE_COUNT];
+static unsigned long long mc_samples[PLATFORM_CORE_COUNT][NOTIF_ITERATIONS];
+static unsigned long long mc_start[PLATFORM_CORE_COUNT];
+static unsigned long long mc_end[PLATFORM_CORE_COUNT];
+static event_t mc_ready[PLATFORM_CORE_COUNT];
+static event_t mc_done[PLATFORM_CORE_COUNT];
+
+static void notif_mc_run(unsigned int core_pos)
+{
+	ffa_notification_bitmap_t got;
+	unsigned long long t0;
+
+	while (!mc_go)
+		;
+
+	mc_start[core_pos] = syscounter_read();
+
+	for (unsigned int i = 0U; i < NOTIF_ITERATIONS; i++) {
+		t0 = syscounter_read();
+
+		if (!notif_set(VM_ID_OF(core_pos), NOTIF_RECEIVER,
+			       FFA_NOTIFICATION(core_pos), false, 0U) ||
+		    !notif_get(false, core_pos, &got)) {
+			ERROR("Core %u: failed set/get cycle %u\n",
+			      core_pos, i);
+			mc_failed = true;
+			return;
+		}
+
+		mc_samples[core_pos][i] = syscounter_read() - t0;
+	}
+
+	mc_end[core_pos] = syscounter_read();
+}
+
+static test_result_t notif_mc_worker(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	if (!sri_handler_register()) {
+		mc_failed = true;
+		tftf_send_event(&mc_ready[core_pos]);
+		tftf_send_event(&mc_done[core_pos]);
+		return TEST_RESULT_FAIL;
+	}
+
+	tftf_send_event(&mc_ready[core_pos]);
+
+	notif_mc_run(core_pos);
+
+	tftf_irq_unregister_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID);
+	tftf_send_event(&mc_done[core_pos]);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Measure the aggregate rate of notification set/get cycles run by
+ * all the cores concurrently
+ *
+ * Report the cycle latency percentiles of all the cores and the aggregate
+ * cycle rate from the first set to the last get.
+ */
+test_result_t test_ffa_notifications_all_cpus(void)
+{
+	u_register_t lead_mpid = read_mpidr_el1() & MPID_MASK;
+	unsigned int lead_pos = platform_get_core_pos(lead_mpid);
+	unsigned long long first_start = ~0ULL, last_end = 0U;
+	unsigned int cpu_node, core_pos, num_cpus = 0U;
+	test_result_t result = TEST_RESULT_SUCCESS;
+	ffa_notification_bitmap_t got;
+	unsigned int bound = 0U;
+	struct perf_stats stats;
+	u_register_t mpidr;
+	int ret;
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+
+	for (; bound < PLATFORM_CORE_COUNT; bound++) {
+		if (!notif_bind(VM_ID_OF(bound), FFA_NOTIFICATION(bound),
+				false)) {
+			ERROR("Failed to bind VM %u\n", bound + 1U);
+			result = TEST_RESULT_FAIL;
+			goto out;
+		}
+	}
+
+	if (!sri_handler_register()) {
+		result = TEST_RESULT_FAIL;
+		goto out;
+	}
+
+	mc_go = false;
+	mc_failed = false;
+	memset(mc_cpu, 0, sizeof(mc_cpu));
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		tftf_init_event(&mc_ready[i]);
+		tftf_init_event(&mc_done[i]);
+	}
+
+	for_each_cpu(cpu_node) {
+		mpidr = tftf_get_mpidr_from_node(cpu_node);
+		core_pos = platform_get_core_pos(mpidr);
+
+		if (mpidr != lead_mpid) {
+			ret = tftf_cpu_on(mpidr, (uintptr_t)notif_mc_worker, 0U);
+			if (ret != PSCI_E_SUCCESS) {
+				ERROR("tftf_cpu_on mpidr 0x%llx returns %d\n",
+				      (unsigned long long)mpidr, ret);
+				mc_failed = true;
+				break;
+			}
+			tftf_wait_for_event(&mc_ready[core_pos]);
+		}
+
+		mc_cpu[core_pos] = true;
+	}
+
+	/* Release the cores which are online, even if some failed to start */
+	dsbish();
+	mc_go = true;
+	dsbish();
+	sev();
+
+	if (!mc_failed) {
+		notif_mc_run(lead_pos);
+	}
+
+	for (core_pos = 0U; core_pos < PLATFORM_CORE_COUNT; core_pos++) {
+		if (mc_cpu[core_pos] && (core_pos != lead_pos)) {
+			tftf_wait_for_event(&mc_done[core_pos]);
+		}
+	}
+
+	tftf_irq_unregister_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID);
+
+	if (mc_failed) {
+		result = TEST_RESULT_FAIL;
+		goto out;
+	}
+
+	/* Gather the samples of all the cores at the start of the array */
+	for (core_pos = 0U; core_pos < PLATFORM_CORE_COUNT; core_pos++) {
+		if (!mc_cpu[core_pos]) {
+			continue;
+		}
+
+		if (mc_start[core_pos] < first_start) {
+			first_start = mc_start[core_pos];
+		}
+		if (mc_end[core_pos] > last_end) {
+			last_end = mc_end[core_pos];
+		}
+
+		if (num_cpus != core_pos) {
+			memcpy(mc_samples[num_cpus], mc_samples[core_pos],
+			       sizeof(mc_samples[core_pos]));
+		}
+		num_cpus++;
+	}
+
+	perf_stats_compute(&mc_samples[0][0], num_cpus * NOTIF_ITERATIONS,
+			   &stats);
+	perf_stats_print("Set/get cycle, all cores", &stats);
+	tftf_testcase_printf("%u cores: %llu cycles/s\n", num_cpus,
+			     perf_ops_per_sec(num_cpus * NOTIF_ITERATIONS,
+					      last_end - first_start));
+
+out:
+	/* Drop the notifications still pending before unbinding them */
+	notif_get(false, 0U, &got);
+
+	for (unsigned int s = 0U; s < bound; s++) {
+		if (!notif_unbind(VM_ID_OF(s), FFA_NOTIFICATION(s))) {
+			result = TEST_RESULT_FAIL;
+		}
+	}
+
+	return result;
+}
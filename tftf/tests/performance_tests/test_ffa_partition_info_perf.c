@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains a benchmark of the discovery of a partition by UUID:
+ *  - with FFA_PARTITION_INFO_GET, which returns the information in the RX
+ *    buffer, followed by FFA_RX_RELEASE to give the buffer back to the SPMC;
+ *  - with FFA_PARTITION_INFO_GET_REGS, which returns it in registers;
+ *  - from the discovery cache, once populated, and the cost of populating it.
+ */
+
+#include <arch_helpers.h>
+#include <debug.h>
+#include <ffa_endpoints.h>
+#include <ffa_helpers.h>
+#include <spm_common.h>
+#include <spm_test_helpers.h>
+#include <test_helpers.h>
+#include <tftf_lib.h>
+
+#include "perf_stats.h"
+
+#define DISCOVERY_ITERATIONS	256U
+
+static const struct ffa_uuid expected_sp_uuids[] = {
+	{PRIMARY_UUID}
+};
+
+static const struct ffa_uuid discovery_uuid = {PRIMARY_UUID};
+
+static unsigned long long samples[DISCOVERY_ITERATIONS];
+
+static void discovery_print(const char *name, unsigned long long total)
+{
+	struct perf_stats stats;
+
+	perf_stats_compute(samples, DISCOVERY_ITERATIONS, &stats);
+	perf_stats_print(name, &stats);
+	tftf_testcase_printf("%s: %llu lookups/s\n", name,
+			     perf_ops_per_sec(DISCOVERY_ITERATIONS, total));
+}
+
+/*
+ * @Test_Aim@ Compare the cost of the discovery of a partition through the RX
+ * buffer, through registers and from the discovery cache
+ *
+ * Look SP1 up by UUID in a loop with each method, checking that it is found
+ * with the expected ID. FFA_PARTITION_INFO_GET_REGS is skipped if the SPMC
+ * returns NOT_SUPPORTED for it at the normal world instance.
+ */
+test_result_t test_ffa_partition_info_discovery_perf(void)
+{
+	struct ffa_partition_info info;
+	unsigned long long start, t0;
+	struct mailbox_buffers mb;
+	struct ffa_value ret;
+	uint32_t count;
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+	GET_TFTF_MAILBOX(mb);
+
+	/* RX buffer based discovery */
+	start = syscounter_read();
+	for (unsigned int i = 0U; i < DISCOVERY_ITERATIONS; i++) {
+		t0 = syscounter_read();
+		ret = ffa_partition_info_get(discovery_uuid);
+		if ((ffa_func_id(ret) != FFA_SUCCESS_SMC32) ||
+		    (ffa_partition_info_count(ret) != 1U) ||
+		    (((struct ffa_partition_info *)mb.recv)->id != SP_ID(1))) {
+			ERROR("FFA_PARTITION_INFO_GET %u failed\n", i);
+			ffa_rx_release();
+			return TEST_RESULT_FAIL;
+		}
+
+		ret = ffa_rx_release();
+		samples[i] = syscounter_read() - t0;
+
+		if (is_ffa_call_error(ret)) {
+			ERROR("Failed to release RX buffer\n");
+			return TEST_RESULT_FAIL;
+		}
+	}
+	discovery_print("PARTITION_INFO_GET + RX_RELEASE",
+			syscounter_read() - start);
+
+	/* Register based discovery */
+	start = syscounter_read();
+	for (unsigned int i = 0U; i < DISCOVERY_ITERATIONS; i++) {
+		t0 = syscounter_read();
+		ret = ffa_partition_info_get_regs(discovery_uuid, 0U, 0U);
+		samples[i] = syscounter_read() - t0;
+
+		if ((i == 0U) && is_ffa_call_error(ret) &&
+		    (ffa_error_code(ret) == FFA_ERROR_NOT_SUPPORTED)) {
+			tftf_testcase_printf("PARTITION_INFO_GET_REGS: not supported\n");
+			break;
+		}
+
+		if (ffa_func_id(ret) != FFA_SUCCESS_SMC64) {
+			ERROR("FFA_PARTITION_INFO_GET_REGS %u failed\n", i);
+			return TEST_RESULT_FAIL;
+		}
+
+		if ((ffa_partition_info_regs_partition_count(ret) != 1U) ||
+		    !ffa_partition_info_regs_get_part_info(&ret, 0U, &info) ||
+		    (info.id != SP_ID(1))) {
+			ERROR("FFA_PARTITION_INFO_GET_REGS %u failed\n", i);
+			return TEST_RESULT_FAIL;
+		}
+
+		if (i == (DISCOVERY_ITERATIONS - 1U)) {
+			discovery_print("PARTITION_INFO_GET_REGS",
+					syscounter_read() - start);
+		}
+	}
+
+	/* Population of the discovery cache */
+	start = syscounter_read();
+	for (unsigned int i = 0U; i < DISCOVERY_ITERATIONS; i++) {
+		ffa_partition_info_cache_invalidate();
+
+		t0 = syscounter_read();
+		if (!ffa_partition_info_cache_populate(&mb)) {
+			ERROR("Failed to populate the partition info cache\n");
+			return TEST_RESULT_FAIL;
+		}
+		samples[i] = syscounter_read() - t0;
+	}
+	discovery_print("Cache population", syscounter_read() - start);
+
+	/* Cached discovery */
+	start = syscounter_read();
+	for (unsigned int i = 0U; i < DISCOVERY_ITERATIONS; i++) {
+		t0 = syscounter_read();
+		if (!ffa_partition_info_cache_get(&mb, discovery_uuid, &info,
+						  1U, &count) ||
+		    (count != 1U) || (info.id != SP_ID(1))) {
+			ERROR("Cached lookup %u failed\n", i);
+			return TEST_RESULT_FAIL;
+		}
+		samples[i] = syscounter_read() - t0;
+	}
+	discovery_print("Cached lookup", syscounter_read() - start);
+
+	return TEST_RESULT_SUCCESS;
+}
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains benchmarks of the latency of a non-secure interrupt
+ * which triggers while the secure world is running on behalf of the normal
+ * world:
+ *  - an SP capable of managed exit, or not, busy sleeping;
+ *  - a chain of two SPs, the second one busy sleeping, with or without
+ *    managed exit support;
+ *  - an SP busy looping while yielding its cycles back with FFA_YIELD;
+ * and, as a reference, the normal world itself busy waiting.
+ *
+ * The timer framework interrupt is programmed to fire halfway through the
+ * run of the SP, and the latency is the delay between its expiry and the
+ * entry in the handler of the TFTF. The run of the SP is then completed,
+ * resuming it as many times as it was preempted. The SP run length is swept
+ * to check that the latency doesn't depend on how long the SP runs, and the
+ * worst case over the run lengths is reported.
+ */
+
+#include <arch_helpers.h>
+#include <cactus_test_cmds.h>
+#include <debug.h>
+#include <events.h>
+#include <ffa_endpoints.h>
+#include <ffa_helpers.h>
+#include <plat_topology.h>
+#include <platform.h>
+#include <platform_def.h>
+#include <power_management.h>
+#include <psci.h>
+#include <spm_common.h>
+#include <spm_test_helpers.h>
+#include <stdbool.h>
+#include <string.h>
+#include <test_helpers.h>
+#include <tftf_lib.h>
+#include <timer.h>
+
+#include "perf_stats.h"
+
+#define PREEMPT_ITERATIONS	16U
+#define PREEMPT_YIELD_US	500U
+
+/* Give up waiting for the timer interrupt after this long */
+#define PREEMPT_TIMEOUT_MS	100U
+
+static const struct ffa_uuid expected_sp_uuids[] = {
+	{PRIMARY_UUID}, {SECONDARY_UUID}, {TERTIARY_UUID}
+};
+
+/* How long the SP runs, the timer fires halfway through */
+static const uint32_t run_lengths_ms[] = { 2U, 5U, 10U };
+
+enum preempt_kind {
+	PREEMPT_NWD_BUSY = 0,
+	PREEMPT_SLEEP,
+	PREEMPT_FWD_SLEEP,
+	PREEMPT_YIELD_LOOP,
+};
+
+struct preempt_scenario {
+	const char *name;
+	/* Column header of the per-core table */
+	const char *short_name;
+	enum preempt_kind kind;
+	ffa_id_t dest;
+	ffa_id_t fwd_dest;
+};
+
+static const struct preempt_scenario scenarios[] = {
+	{ "NWd busy", "NWd", PREEMPT_NWD_BUSY, 0, 0 },
+	{ "SP1 sleeping, managed exit", "SP1 ME", PREEMPT_SLEEP, SP_ID(1), 0 },
+	{ "SP2 sleeping, signaled", "SP2 sig", PREEMPT_SLEEP, SP_ID(2), 0 },
+	{ "SP1 -> SP3 sleeping, managed exit", "SP1>3 ME", PREEMPT_FWD_SLEEP,
+	  SP_ID(1), SP_ID(3) },
+	{ "SP1 -> SP2 sleeping, signaled", "SP1>2 sig", PREEMPT_FWD_SLEEP,
+	  SP_ID(1), SP_ID(2) },
+	{ "SP1 yielding", "SP1 yld", PREEMPT_YIELD_LOOP, SP_ID(1), 0 },
+};
+
+static unsigned long long samples[PLATFORM_CORE_COUNT][PREEMPT_ITERATIONS];
+static volatile unsigned long long timer_fire_time[PLATFORM_CORE_COUNT];
+static volatile bool timer_fired[PLATFORM_CORE_COUNT];
+
+static int preempt_timer_handler(void *data)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	timer_fire_time[core_pos] = syscounter_read();
+	timer_fired[core_pos] = true;
+
+	return 0;
+}
+
+static bool preempt_timed_out(unsigned long long start)
+{
+	return (syscounter_read() - start) >
+		((read_cntfrq_el0() * PREEMPT_TIMEOUT_MS) / 1000U);
+}
+
+/*
+ * Run 'scenario' for 'run_ms' and return once the SP sent its final response,
+ * resuming it each time it is preempted or yields.
+ */
+static bool preempt_run(const struct preempt_scenario *scenario,
+			uint32_t run_ms, unsigned int core_pos)
+{
+	struct ffa_value ret;
+
+	switch (scenario->kind) {
+	case PREEMPT_SLEEP:
+		ret = cactus_sleep_cmd(HYP_ID, scenario->dest, run_ms);
+		break;
+	case PREEMPT_FWD_SLEEP:
+		ret = cactus_fwd_sleep_cmd(HYP_ID, scenario->dest,
+					   scenario->fwd_dest, run_ms, false);
+		break;
+	case PREEMPT_YIELD_LOOP:
+		ret = cactus_yield_loop_cmd(HYP_ID, scenario->dest, run_ms,
+					    PREEMPT_YIELD_US);
+		break;
+	default:
+		waitms(run_ms);
+		return true;
+	}
+
+	for (;;) {
+		if ((ffa_func_id(ret) == FFA_INTERRUPT) ||
+		    (ffa_func_id(ret) == FFA_MSG_YIELD)) {
+			ret = ffa_run(scenario->dest, core_pos);
+		} else if (is_expected_cactus_response(
+				ret, MANAGED_EXIT_INTERRUPT_ID, 0)) {
+			ret = cactus_resume_after_managed_exit(HYP_ID,
+							       scenario->dest);
+		} else {
+			break;
+		}
+	}
+
+	return is_ffa_direct_response(ret) &&
+	       (cactus_get_response(ret) != CACTUS_ERROR);
+}
+
+/*
+ * Measure the latency of the timer interrupt during 'scenario' on the calling
+ * core, and return its percentiles in 'stats'.
+ */
+static int preempt_measure(const struct preempt_scenario *scenario,
+			   uint32_t run_ms, struct perf_stats *stats)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	unsigned long long deadline, start;
+	uint32_t timer_us = run_ms * 500U;
+	int result = 0;
+
+	tftf_timer_register_handler(preempt_timer_handler);
+
+	for (unsigned int i = 0U; i < PREEMPT_ITERATIONS; i++) {
+		timer_fired[core_pos] = false;
+
+		if (tftf_program_timer_us_deadline(timer_us, &deadline) != 0) {
+			ERROR("Failed to program the timer\n");
+			result = -1;
+			break;
+		}
+
+		if (!preempt_run(scenario, run_ms, core_pos)) {
+			ERROR("%s: unexpected response\n", scenario->name);
+			tftf_cancel_timer();
+			result = -1;
+			break;
+		}
+
+		start = syscounter_read();
+		while (!timer_fired[core_pos]) {
+			if (preempt_timed_out(start)) {
+				ERROR("%s: timer interrupt lost\n",
+				      scenario->name);
+				tftf_cancel_timer();
+				result = -1;
+				break;
+			}
+		}
+
+		if (result != 0) {
+			break;
+		}
+
+		samples[core_pos][i] = (timer_fire_time[core_pos] > deadline) ?
+				       (timer_fire_time[core_pos] - deadline) :
+				       0U;
+	}
+
+	tftf_timer_unregister_handler();
+
+	if (result == 0) {
+		perf_stats_compute(samples[core_pos], PREEMPT_ITERATIONS,
+				   stats);
+	}
+
+	return result;
+}
+
+/*
+ * Run 'scenario' with each SP run length on the calling core and return the
+ * highest of each percentile over the run lengths in 'worst'.
+ */
+static int preempt_measure_worst(const struct preempt_scenario *scenario,
+				 struct perf_stats *worst)
+{
+	struct perf_stats stats;
+
+	memset(worst, 0, sizeof(*worst));
+
+	for (unsigned int r = 0U; r < ARRAY_SIZE(run_lengths_ms); r++) {
+		if (preempt_measure(scenario, run_lengths_ms[r], &stats) != 0) {
+			return -1;
+		}
+
+		worst->p50 = MAX(worst->p50, stats.p50);
+		worst->p90 = MAX(worst->p90, stats.p90);
+		worst->p99 = MAX(worst->p99, stats.p99);
+		worst->max = MAX(worst->max, stats.max);
+	}
+
+	return 0;
+}
+
+/*
+ * @Test_Aim@ Measure the latency of a non-secure interrupt while the secure
+ * world is busy
+ *
+ * From the lead CPU, for each scenario and SP run length, program the timer
+ * to fire halfway through the run of the SP and measure the delay until the
+ * TFTF handles the interrupt. Report the highest percentiles over the run
+ * lengths, one line per scenario.
+ */
+test_result_t test_ffa_preemption_latency(void)
+{
+	struct perf_stats worst;
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+
+	tftf_testcase_printf("Worst over SP runs of 2/5/10 ms, ns\n");
+	tftf_testcase_printf("%-34s %8s %8s %8s\n", "", "p50", "p99", "max");
+
+	for (unsigned int s = 0U; s < ARRAY_SIZE(scenarios); s++) {
+		if (preempt_measure_worst(&scenarios[s], &worst) != 0) {
+			return TEST_RESULT_FAIL;
+		}
+
+		tftf_testcase_printf("%-34s %8llu %8llu %8llu\n",
+				     scenarios[s].name, worst.p50, worst.p99,
+				     worst.max);
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * Worst case latency of each core, in nanoseconds.
+ *
+ * The cores run the scenarios one after the other, so that they don't contend
+ * for the uniprocessor SP3 and the latency of each of them is measured on an
+ * otherwise idle system.
+ */
+static unsigned long long worst_case[PLATFORM_CORE_COUNT][ARRAY_SIZE(scenarios)];
+static volatile bool mc_failed;
+static event_t mc_done[PLATFORM_CORE_COUNT];
+
+static void preempt_worst_case(unsigned int core_pos)
+{
+	struct perf_stats worst;
+
+	for (unsigned int s = 0U; s < ARRAY_SIZE(scenarios); s++) {
+		if (preempt_measure_worst(&scenarios[s], &worst) != 0) {
+			mc_failed = true;
+			return;
+		}
+
+		worst_case[core_pos][s] = worst.max;
+	}
+}
+
+static test_result_t preempt_mc_worker(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	preempt_worst_case(core_pos);
+	tftf_send_event(&mc_done[core_pos]);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Measure the worst case latency of a non-secure interrupt while
+ * the secure world is busy, on each core
+ *
+ * Each core in turn runs all the scenarios with all the SP run lengths.
+ * Report the worst case latency of each scenario on each core.
+ */
+test_result_t test_ffa_preemption_latency_all_cpus(void)
+{
+	u_register_t lead_mpid = read_mpidr_el1() & MPID_MASK;
+	unsigned int cpu_node, core_pos;
+	bool measured[PLATFORM_CORE_COUNT] = { false };
+	u_register_t mpidr;
+	int ret;
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+
+	mc_failed = false;
+
+	for_each_cpu(cpu_node) {
+		mpidr = tftf_get_mpidr_from_node(cpu_node);
+		core_pos = platform_get_core_pos(mpidr);
+
+		if (mpidr == lead_mpid) {
+			preempt_worst_case(core_pos);
+		} else {
+			tftf_init_event(&mc_done[core_pos]);
+
+			ret = tftf_cpu_on(mpidr, (uintptr_t)preempt_mc_worker,
+					  0U);
+			if (ret != PSCI_E_SUCCESS) {
+				ERROR("tftf_cpu_on mpidr 0x%llx returns %d\n",
+				      (unsigned long long)mpidr, ret);
+				return TEST_RESULT_FAIL;
+			}
+
+			tftf_wait_for_event(&mc_done[core_pos]);
+		}
+
+		if (mc_failed) {
+			return TEST_RESULT_FAIL;
+		}
+
+		measured[core_pos] = true;
+	}
+
+	tftf_testcase_printf("Worst case ns\n%-7s", "");
+	for (unsigned int s = 0U; s < ARRAY_SIZE(scenarios); s++) {
+		tftf_testcase_printf(" %9s", scenarios[s].short_name);
+	}
+	tftf_testcase_printf("\n");
+
+	for (core_pos = 0U; core_pos < PLATFORM_CORE_COUNT; core_pos++) {
+		if (!measured[core_pos]) {
+			continue;
+		}
+
+		tftf_testcase_printf("Core %-2u", core_pos);
+		for (unsigned int s = 0U; s < ARRAY_SIZE(scenarios); s++) {
+			tftf_testcase_printf(" %9llu", worst_case[core_pos][s]);
+		}
+		tftf_testcase_printf("\n");
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
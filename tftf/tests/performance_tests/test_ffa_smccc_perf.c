@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains benchmarks of the FF-A call path from the normal world:
+ *  - the round trip cost of FF-A calls with the SMC32 and SMC64 conventions,
+ *    through the plain x0-x17 call wrapper and through the wrappers checking
+ *    that x8-x29 or x18-x29 are preserved, as the SMCCC tests do;
+ *  - the same calls with and without the SMCCC SVE hint bit, while the SVE
+ *    or Streaming SVE registers hold live state, to quantify the saving of
+ *    the SVE context the hint allows.
+ *
+ * The FF-A helpers don't go through tftf_smc(), which sets the SVE hint
+ * from the trap configuration of SVE, so the calls are built here and the
+ * hint bit is set in their function ID directly. That allows measuring the
+ * hint while SVE is enabled, in which case the upper bits of the Z registers
+ * may not be preserved, which doesn't matter to this benchmark.
+ */
+
+#include <arch_features.h>
+#include <arch_helpers.h>
+#include <cactus_test_cmds.h>
+#include <debug.h>
+#include <ffa_endpoints.h>
+#include <ffa_helpers.h>
+#include <ffa_svc.h>
+#include <lib/extensions/sme.h>
+#include <lib/extensions/sve.h>
+#include <smccc.h>
+#include <spm_common.h>
+#include <spm_test_helpers.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <test_helpers.h>
+#include <tftf_lib.h>
+
+#include "perf_stats.h"
+
+#define SMCCC_PERF_ITERATIONS	512U
+#define SMCCC_PERF_TARGET	SP_ID(1)
+
+static const struct ffa_uuid expected_sp_uuids[] = {
+	{PRIMARY_UUID}
+};
+
+/* Same layout as in test_ffa_smccc.c */
+struct ffa_value8 {
+	u_register_t fid;
+	u_register_t arg1;
+	u_register_t arg2;
+	u_register_t arg3;
+	u_register_t arg4;
+	u_register_t arg5;
+	u_register_t arg6;
+	u_register_t arg7;
+};
+
+/* Declared in test_ffa_smccc_asm.S. */
+uint32_t test_ffa_smc(struct ffa_value8 *);
+uint32_t test_ffa_smc_ext(struct ffa_value *);
+
+struct smccc_perf_call {
+	const char *name;
+	uint32_t fid;
+	/* The call is an echo command to SMCCC_PERF_TARGET */
+	bool echo;
+};
+
+static const struct smccc_perf_call perf_calls[] = {
+	{ "FFA_VERSION", FFA_VERSION, false },
+	{ "FFA_ID_GET", FFA_ID_GET, false },
+	{ "DIRECT_REQ SMC32", FFA_MSG_SEND_DIRECT_REQ_SMC32, true },
+	{ "DIRECT_REQ SMC64", FFA_MSG_SEND_DIRECT_REQ_SMC64, true },
+};
+
+enum smccc_perf_wrapper {
+	/* ffa_smc(): x0-x17 in and out */
+	WRAPPER_X17 = 0,
+	/* test_ffa_smc(): x0-x7 in and out, checks x8-x29 are preserved */
+	WRAPPER_X7_CHECKED,
+	/* test_ffa_smc_ext(): x0-x17 in and out, checks x18-x29 */
+	WRAPPER_X17_CHECKED,
+	WRAPPER_COUNT
+};
+
+static const char * const wrapper_names[WRAPPER_COUNT] = {
+	"x0-17", "x0-7 chk x8-29", "x0-17 chk x18-29"
+};
+
+static unsigned long long samples[SMCCC_PERF_ITERATIONS];
+static sve_z_regs_t sve_vectors;
+
+static void smccc_perf_init_args(const struct smccc_perf_call *call,
+				 bool sve_hint, uint32_t val,
+				 struct ffa_value *args)
+{
+	memset(args, 0, sizeof(*args));
+
+	args->fid = call->fid;
+	if (sve_hint) {
+		args->fid |= MASK(FUNCID_SVE_HINT);
+	}
+
+	if (call->fid == FFA_VERSION) {
+		args->arg1 = FFA_VERSION_COMPILED;
+	} else if (call->echo) {
+		args->arg1 = ((uint32_t)(HYP_ID << 16)) | SMCCC_PERF_TARGET;
+		args->arg3 = CACTUS_ECHO_CMD;
+		args->arg4 = val;
+	}
+}
+
+/* Issue 'call' through 'wrapper' and check its result. */
+static bool smccc_perf_issue(const struct smccc_perf_call *call,
+			     enum smccc_perf_wrapper wrapper, bool sve_hint,
+			     uint32_t val)
+{
+	struct ffa_value8 args8;
+	struct ffa_value args;
+
+	smccc_perf_init_args(call, sve_hint, val, &args);
+
+	switch (wrapper) {
+	case WRAPPER_X7_CHECKED:
+		memcpy(&args8, &args, sizeof(args8));
+		if (test_ffa_smc(&args8) != 0U) {
+			ERROR("%s: registers not preserved\n", call->name);
+			return false;
+		}
+		memcpy(&args, &args8, sizeof(args8));
+		break;
+	case WRAPPER_X17_CHECKED:
+		if (test_ffa_smc_ext(&args) != 0U) {
+			ERROR("%s: registers not preserved\n", call->name);
+			return false;
+		}
+		break;
+	default:
+		ffa_smc(&args);
+		break;
+	}
+
+	if (call->fid == FFA_VERSION) {
+		return args.fid == FFA_VERSION_COMPILED;
+	}
+
+	if (call->echo) {
+		return is_ffa_direct_response(args) &&
+		       (cactus_get_response(args) == CACTUS_SUCCESS) &&
+		       (cactus_echo_get_val(args) == val);
+	}
+
+	return !is_ffa_call_error(args);
+}
+
+/*
+ * Time SMCCC_PERF_ITERATIONS issues of 'call' and return their percentiles in
+ * 'stats'. 'label' only identifies the measurement in error messages.
+ */
+static int smccc_perf_measure(const struct smccc_perf_call *call,
+			      enum smccc_perf_wrapper wrapper, bool sve_hint,
+			      const char *label, struct perf_stats *stats)
+{
+	unsigned long long t0;
+	bool ok;
+
+	for (unsigned int i = 0U; i < SMCCC_PERF_ITERATIONS; i++) {
+		t0 = syscounter_read();
+		ok = smccc_perf_issue(call, wrapper, sve_hint, ECHO_VAL1 + i);
+		samples[i] = syscounter_read() - t0;
+
+		if (!ok) {
+			ERROR("%s (%s): unexpected result of call %u\n",
+			      call->name, label, i);
+			return -1;
+		}
+	}
+
+	perf_stats_compute(samples, SMCCC_PERF_ITERATIONS, stats);
+
+	return 0;
+}
+
+/*
+ * @Test_Aim@ Measure the round trip cost of FF-A calls per calling convention
+ * and register set
+ *
+ * Issue calls handled at EL3 or by the SPMC, and direct requests to SP1 with
+ * the SMC32 and SMC64 conventions, through the plain x0-x17 call wrapper and
+ * through the wrappers checking the preservation of the registers which are
+ * not part of the call, as the SMCCC compliance tests do.
+ */
+test_result_t test_ffa_smccc_perf_conventions(void)
+{
+	struct perf_stats stats[WRAPPER_COUNT];
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+
+	tftf_testcase_printf("p50/p99 ns\n%-16s %16s %16s %16s\n", "",
+			     wrapper_names[WRAPPER_X17],
+			     wrapper_names[WRAPPER_X7_CHECKED],
+			     wrapper_names[WRAPPER_X17_CHECKED]);
+
+	for (unsigned int c = 0U; c < ARRAY_SIZE(perf_calls); c++) {
+		for (unsigned int w = 0U; w < WRAPPER_COUNT; w++) {
+			if (smccc_perf_measure(&perf_calls[c], w, false,
+					       wrapper_names[w],
+					       &stats[w]) != 0) {
+				return TEST_RESULT_FAIL;
+			}
+		}
+
+		tftf_testcase_printf("%-16s %8llu/%-7llu %8llu/%-7llu %8llu/%-7llu\n",
+				     perf_calls[c].name,
+				     stats[WRAPPER_X17].p50,
+				     stats[WRAPPER_X17].p99,
+				     stats[WRAPPER_X7_CHECKED].p50,
+				     stats[WRAPPER_X7_CHECKED].p99,
+				     stats[WRAPPER_X17_CHECKED].p50,
+				     stats[WRAPPER_X17_CHECKED].p99);
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * Append 'value' to 'row' as a column of the SVE hint table, or a dash if the
+ * column wasn't measured.
+ */
+static void smccc_perf_print_col(char *row, size_t size, bool measured,
+				 unsigned long long value)
+{
+	size_t len = strlen(row);
+
+	if (measured) {
+		snprintf(row + len, size - len, " %9llu", value);
+	} else {
+		snprintf(row + len, size - len, " %9s", "-");
+	}
+}
+
+/*
+ * @Test_Aim@ Measure the saving of the SMCCC SVE hint on FF-A calls while SVE
+ * or Streaming SVE state is live
+ *
+ * With the largest vector length and random values in the Z registers, issue
+ * each call with and without the SVE hint bit. Compare with calls issued with
+ * SVE disabled, when only the FP/SIMD state is live, and with calls issued in
+ * Streaming SVE mode, for which the hint is ignored.
+ */
+test_result_t test_ffa_smccc_perf_sve_hint(void)
+{
+	test_result_t result = TEST_RESULT_SUCCESS;
+	struct perf_stats off = { 0 }, hint = { 0 }, no_hint = { 0 };
+	struct perf_stats ssve = { 0 };
+	const bool sve = is_armv8_2_sve_present();
+	const bool sme = is_feat_sme_supported();
+	const struct smccc_perf_call *call;
+	char row[80];
+	bool ratio;
+
+	if (!sve && !sme) {
+		tftf_testcase_printf("Neither SVE nor SME is supported\n");
+		return TEST_RESULT_SKIPPED;
+	}
+
+	CHECK_SPMC_TESTING_SETUP(1, 1, expected_sp_uuids);
+
+	/*
+	 * p50 of the calls with SVE disabled and the hint set, with SVE live
+	 * without and with the hint, and in Streaming SVE mode.
+	 */
+	tftf_testcase_printf("p50 ns\n%-16s %9s %9s %9s %9s %9s\n", "",
+			     "SVE off", "no hint", "hint", "hint %", "SSVE");
+
+	for (unsigned int c = 0U; c < ARRAY_SIZE(perf_calls); c++) {
+		call = &perf_calls[c];
+
+		if (sve) {
+			/* Only the FP/SIMD state is live */
+			tftf_smc_set_sve_hint(true);
+			if (smccc_perf_measure(call, WRAPPER_X17, true,
+					       "SVE disabled, hint", &off) != 0) {
+				result = TEST_RESULT_FAIL;
+				break;
+			}
+
+			tftf_smc_set_sve_hint(false);
+			sve_config_vq(SVE_VQ_ARCH_MAX);
+			sve_z_regs_write_rand(&sve_vectors);
+
+			if ((smccc_perf_measure(call, WRAPPER_X17, false,
+						"SVE live, no hint",
+						&no_hint) != 0) ||
+			    (smccc_perf_measure(call, WRAPPER_X17, true,
+						"SVE live, hint", &hint) != 0)) {
+				result = TEST_RESULT_FAIL;
+				break;
+			}
+		}
+
+		if (sme) {
+			sme_smstart(SMSTART_SM);
+			sme_config_svq(SME_SVQ_ARCH_MAX);
+			sve_z_regs_write_rand(&sve_vectors);
+
+			if (smccc_perf_measure(call, WRAPPER_X17, false,
+					       "Streaming SVE live",
+					       &ssve) != 0) {
+				result = TEST_RESULT_FAIL;
+			}
+
+			sme_smstop(SMSTOP_SM);
+
+			if (result != TEST_RESULT_SUCCESS) {
+				break;
+			}
+		}
+
+		snprintf(row, sizeof(row), "%-16s", call->name);
+		smccc_perf_print_col(row, sizeof(row), sve, off.p50);
+		smccc_perf_print_col(row, sizeof(row), sve, no_hint.p50);
+		smccc_perf_print_col(row, sizeof(row), sve, hint.p50);
+		/* Median with the hint relatively to the one without */
+		ratio = sve && (no_hint.p50 != 0U);
+		smccc_perf_print_col(row, sizeof(row), ratio,
+				     ratio ? (hint.p50 * 100U) / no_hint.p50 :
+					     0U);
+		smccc_perf_print_col(row, sizeof(row), sme, ssve.p50);
+		tftf_testcase_printf("%s\n", row);
+	}
+
+	/* Restore the default SVE configuration */
+	tftf_smc_set_sve_hint(false);
+
+	return result;
+}
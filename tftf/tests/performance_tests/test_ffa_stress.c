@@ -0,0 +1,700 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains a stress engine which sends FF-A traffic from all the
+ * cores to all the deployed Secure Partitions at once, for a fixed duration:
+ *  - echo direct requests to SP1, SP2, SP3 and, if deployed, Ivy;
+ *  - share or lend, retrieve, relinquish and reclaim cycles of a page with
+ *    SP1, SP2 and SP3;
+ *  - notifications set by a VM and got by SP1 and SP2;
+ *  - indirect messages from a VM to SP1.
+ *
+ * Each core picks its next operation at random, with the relative weights of
+ * a mix, and its next target in turn. The number of operations which
+ * succeeded, were refused with FFA_ERROR_BUSY and failed is counted per core
+ * and per operation, along with the time spent in them. BUSY is returned when
+ * a uniprocessor SP is already running on another core, and is counted as
+ * contention rather than as a failure.
+ *
+ * Some resources can't be used concurrently by the normal world and are
+ * serialised here, so that the contention measured is the one of the SPMC:
+ *  - the TX buffer of the TFTF, to build memory transaction descriptors;
+ *  - the RX buffer of SP1, which holds a single indirect message at a time
+ *    and also receives the FFA_MEM_RETRIEVE_RESP of the memory cycles to SP1.
+ */
+
+#include <arch_helpers.h>
+#include <cactus_test_cmds.h>
+#include <debug.h>
+#include <events.h>
+#include <ffa_endpoints.h>
+#include <ffa_helpers.h>
+#include <irq.h>
+#include <plat_topology.h>
+#include <platform.h>
+#include <platform_def.h>
+#include <power_management.h>
+#include <psci.h>
+#include <spinlock.h>
+#include <spm_common.h>
+#include <spm_test_helpers.h>
+#include <stdbool.h>
+#include <string.h>
+#include <test_helpers.h>
+#include <tftf_lib.h>
+
+#include "perf_stats.h"
+
+/* How long every core sends traffic for */
+#define STRESS_DURATION_MS	1000U
+
+#define STRESS_IND_MSG_SENDER	VM_ID(1)
+#define STRESS_IND_MSG_SIZE	64U
+
+/* VM setting the notifications of core 'n', from VM1 onwards */
+#define VM_ID_OF(n)		VM_ID(((n) + 1U))
+
+/* Each core sets its own notification */
+CASSERT(PLATFORM_CORE_COUNT <= MAX_FFA_NOTIFICATIONS,
+	assert_too_many_cores_for_notifications);
+
+static const struct ffa_uuid expected_sp_uuids[] = {
+	{PRIMARY_UUID}, {SECONDARY_UUID}, {TERTIARY_UUID}
+};
+
+static const struct ffa_uuid ivy_uuid = {IVY_UUID};
+
+enum stress_op {
+	STRESS_ECHO = 0,
+	STRESS_MEM,
+	STRESS_NOTIF,
+	STRESS_IND_MSG,
+	STRESS_OPS
+};
+
+static const char * const op_names[STRESS_OPS] = {
+	"echo", "memory", "notification", "indirect message"
+};
+
+enum stress_result {
+	STRESS_OK = 0,
+	STRESS_BUSY,
+	STRESS_FAILED
+};
+
+struct stress_config {
+	const char *name;
+	/* Relative weight of each operation, 0 to leave it out */
+	unsigned int weights[STRESS_OPS];
+};
+
+static const struct stress_config balanced_mix = {
+	"Balanced", { 4U, 2U, 2U, 2U }
+};
+
+static const struct stress_config memory_mix = {
+	"Memory heavy", { 1U, 8U, 1U, 0U }
+};
+
+static const struct stress_config messaging_mix = {
+	"Messaging heavy", { 4U, 0U, 3U, 3U }
+};
+
+struct stress_target {
+	ffa_id_t id;
+	/* Ivy answers every request with zeros rather than echoing it */
+	bool echo;
+};
+
+static const struct stress_target echo_targets[] = {
+	{ SP_ID(1), true }, { SP_ID(2), true }, { SP_ID(3), true },
+	{ SP_ID(4), false },
+};
+
+static const ffa_id_t mem_targets[] = { SP_ID(1), SP_ID(2), SP_ID(3) };
+static const ffa_id_t notif_targets[] = { SP_ID(1), SP_ID(2) };
+
+struct stress_counters {
+	unsigned long long ok;
+	unsigned long long busy;
+	unsigned long long failed;
+	unsigned long long ticks;
+};
+
+struct stress_core {
+	uint32_t seed;
+	uint32_t seq;
+	unsigned int next_target[STRESS_OPS];
+	struct stress_counters counters[STRESS_OPS];
+};
+
+static struct stress_core cores[PLATFORM_CORE_COUNT];
+
+/* Page each core shares or lends */
+static __aligned(PAGE_SIZE) uint8_t stress_pages[PLATFORM_CORE_COUNT][PAGE_SIZE];
+
+/* RX/TX buffers of the sender of the indirect messages */
+static __aligned(PAGE_SIZE) uint8_t vm1_rx_buffer[PAGE_SIZE];
+static __aligned(PAGE_SIZE) uint8_t vm1_tx_buffer[PAGE_SIZE];
+
+/* Serialise the use of the TX buffer of the TFTF. */
+static spinlock_t tx_lock;
+
+/*
+ * Serialise the use of the RX buffer of SP1, by the indirect messages and the
+ * retrieve requests of SP1.
+ */
+static spinlock_t sp1_rx_lock;
+
+static const struct stress_config *mix;
+static unsigned int echo_target_count;
+static unsigned long long stress_deadline;
+
+static volatile bool mc_go;
+static volatile bool mc_failed;
+static bool mc_cpu[PLATFORM_CORE_COUNT];
+static event_t mc_ready[PLATFORM_CORE_COUNT];
+static event_t mc_done[PLATFORM_CORE_COUNT];
+
+static int sri_handler(void *data)
+{
+	return 0;
+}
+
+static bool is_ffa_busy(struct ffa_value ret)
+{
+	return (ffa_func_id(ret) == FFA_ERROR) &&
+	       (ffa_error_code(ret) == FFA_ERROR_BUSY);
+}
+
+static enum stress_result stress_direct_result(struct ffa_value ret)
+{
+	if (is_ffa_busy(ret)) {
+		return STRESS_BUSY;
+	}
+
+	if (!is_ffa_direct_response(ret) ||
+	    (cactus_get_response(ret) != CACTUS_SUCCESS)) {
+		return STRESS_FAILED;
+	}
+
+	return STRESS_OK;
+}
+
+/* Xorshift, so that every core draws its own reproducible sequence. */
+static uint32_t stress_rand(struct stress_core *core)
+{
+	uint32_t x = core->seed;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	core->seed = x;
+
+	return x;
+}
+
+static enum stress_op stress_pick_op(struct stress_core *core)
+{
+	unsigned int total = 0U, r;
+
+	for (unsigned int op = 0U; op < STRESS_OPS; op++) {
+		total += mix->weights[op];
+	}
+
+	r = stress_rand(core) % total;
+
+	for (unsigned int op = 0U; op < STRESS_OPS; op++) {
+		if (r < mix->weights[op]) {
+			return op;
+		}
+		r -= mix->weights[op];
+	}
+
+	return STRESS_ECHO;
+}
+
+/* Return the index of the next target of 'op', out of 'count'. */
+static unsigned int stress_next_target(struct stress_core *core,
+				       enum stress_op op, unsigned int count)
+{
+	unsigned int i = core->next_target[op] % count;
+
+	core->next_target[op] = i + 1U;
+
+	return i;
+}
+
+static enum stress_result stress_echo(struct stress_core *core)
+{
+	const struct stress_target *target =
+		&echo_targets[stress_next_target(core, STRESS_ECHO,
+						 echo_target_count)];
+	uint32_t val = ECHO_VAL1 + core->seq;
+	enum stress_result result;
+	struct ffa_value ret;
+
+	if (!target->echo) {
+		ret = cactus_echo32_send_cmd(HYP_ID, target->id, val);
+		if (is_ffa_busy(ret)) {
+			return STRESS_BUSY;
+		}
+		return is_ffa_direct_response(ret) ? STRESS_OK : STRESS_FAILED;
+	}
+
+	ret = cactus_echo_send_cmd(HYP_ID, target->id, val);
+	result = stress_direct_result(ret);
+	if ((result == STRESS_OK) && (cactus_echo_get_val(ret) != val)) {
+		result = STRESS_FAILED;
+	}
+
+	return result;
+}
+
+static enum stress_result stress_mem(struct stress_core *core,
+				     unsigned int core_pos)
+{
+	ffa_id_t dest = mem_targets[stress_next_target(core, STRESS_MEM,
+						       ARRAY_SIZE(mem_targets))];
+	uint32_t mem_func = ((stress_rand(core) & 1U) != 0U) ?
+			    FFA_MEM_LEND_SMC64 : FFA_MEM_SHARE_SMC64;
+	struct ffa_memory_access receiver =
+		ffa_memory_access_init_permissions_from_mem_func(dest,
+								 mem_func);
+	struct ffa_memory_region_constituent region = {
+		.address = stress_pages[core_pos],
+		.page_count = 1U,
+		.reserved = 0U,
+	};
+	ffa_memory_handle_t handle;
+	enum stress_result result;
+	struct mailbox_buffers mb;
+	struct ffa_value ret;
+
+	get_tftf_mailbox(&mb);
+
+	spin_lock(&tx_lock);
+	handle = memory_init_and_send(mb.send, mb.size, HYP_ID, &receiver, 1U,
+				      &region, 1U, mem_func, &ret);
+	spin_unlock(&tx_lock);
+
+	if (handle == FFA_MEMORY_HANDLE_INVALID) {
+		return is_ffa_busy(ret) ? STRESS_BUSY : STRESS_FAILED;
+	}
+
+	if (dest == SP_ID(1)) {
+		spin_lock(&sp1_rx_lock);
+	}
+	ret = cactus_mem_perf_send_cmd(HYP_ID, dest, mem_func, handle);
+	if (dest == SP_ID(1)) {
+		spin_unlock(&sp1_rx_lock);
+	}
+	result = stress_direct_result(ret);
+
+	/* The region must be reclaimed even if the SP didn't take it. */
+	ret = ffa_mem_reclaim(handle, 0U);
+	if (is_ffa_call_error(ret)) {
+		ERROR("Core %u: failed to reclaim handle %llx\n", core_pos,
+		      (unsigned long long)handle);
+		return STRESS_FAILED;
+	}
+
+	return result;
+}
+
+static enum stress_result stress_notif(struct stress_core *core,
+				       unsigned int core_pos)
+{
+	ffa_id_t dest = notif_targets[stress_next_target(
+		core, STRESS_NOTIF, ARRAY_SIZE(notif_targets))];
+	struct ffa_value ret;
+
+	ret = ffa_notification_set(VM_ID_OF(core_pos), dest, 0U,
+				   FFA_NOTIFICATION(core_pos));
+	if (is_ffa_call_error(ret)) {
+		return is_ffa_busy(ret) ? STRESS_BUSY : STRESS_FAILED;
+	}
+
+	/*
+	 * The receiver may get the notifications set by other cores along
+	 * with this one, so only the success of the call is checked.
+	 */
+	ret = cactus_notification_get_send_cmd(HYP_ID, dest, dest, core_pos,
+					       FFA_NOTIFICATIONS_FLAG_BITMAP_VM,
+					       false);
+
+	return stress_direct_result(ret);
+}
+
+static enum stress_result stress_ind_msg(struct stress_core *core)
+{
+	enum stress_result result = STRESS_FAILED;
+	struct ffa_value ret;
+	uint8_t *payload;
+	uint64_t sum = 0U;
+
+	spin_lock(&sp1_rx_lock);
+
+	payload = indirect_message_tx_reserve(STRESS_IND_MSG_SENDER, SP_ID(1),
+					      vm1_tx_buffer,
+					      STRESS_IND_MSG_SIZE);
+	if (payload == NULL) {
+		goto out;
+	}
+
+	for (unsigned int i = 0U; i < STRESS_IND_MSG_SIZE; i++) {
+		payload[i] = (uint8_t)(i + core->seq);
+		sum += payload[i];
+	}
+
+	ret = ffa_msg_send2_with_id(0, STRESS_IND_MSG_SENDER);
+	if (is_ffa_call_error(ret)) {
+		result = is_ffa_busy(ret) ? STRESS_BUSY : STRESS_FAILED;
+		goto out;
+	}
+
+	ret = cactus_ind_msg_recv_cmd(HYP_ID, SP_ID(1), true);
+	result = stress_direct_result(ret);
+	if ((result == STRESS_OK) &&
+	    ((cactus_ind_msg_recv_get_size(ret) != STRESS_IND_MSG_SIZE) ||
+	     (cactus_ind_msg_recv_get_sum(ret) != sum) ||
+	     (cactus_ind_msg_recv_get_sender(ret) != STRESS_IND_MSG_SENDER))) {
+		result = STRESS_FAILED;
+	}
+
+out:
+	spin_unlock(&sp1_rx_lock);
+
+	return result;
+}
+
+static void stress_run(unsigned int core_pos)
+{
+	struct stress_core *core = &cores[core_pos];
+	struct stress_counters *counters;
+	enum stress_result result;
+	unsigned long long t0;
+	enum stress_op op;
+
+	while (!mc_go)
+		;
+
+	while (!mc_failed && (syscounter_read() < stress_deadline)) {
+		op = stress_pick_op(core);
+		core->seq++;
+
+		t0 = syscounter_read();
+
+		switch (op) {
+		case STRESS_MEM:
+			result = stress_mem(core, core_pos);
+			break;
+		case STRESS_NOTIF:
+			result = stress_notif(core, core_pos);
+			break;
+		case STRESS_IND_MSG:
+			result = stress_ind_msg(core);
+			break;
+		default:
+			result = stress_echo(core);
+			break;
+		}
+
+		counters = &core->counters[op];
+		counters->ticks += syscounter_read() - t0;
+
+		if (result == STRESS_OK) {
+			counters->ok++;
+		} else if (result == STRESS_BUSY) {
+			counters->busy++;
+		} else {
+			ERROR("Core %u: %s %u failed\n", core_pos, op_names[op],
+			      core->seq);
+			counters->failed++;
+			mc_failed = true;
+		}
+	}
+}
+
+static test_result_t stress_mc_worker(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	tftf_irq_register_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID,
+				  sri_handler);
+	tftf_send_event(&mc_ready[core_pos]);
+
+	stress_run(core_pos);
+
+	tftf_irq_unregister_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID);
+	tftf_send_event(&mc_done[core_pos]);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+static bool stress_notif_bind(ffa_id_t receiver, unsigned int core_pos,
+			      bool bind)
+{
+	struct ffa_value ret;
+
+	if (bind) {
+		ret = cactus_notification_bind_send_cmd(
+			HYP_ID, receiver, receiver, VM_ID_OF(core_pos),
+			FFA_NOTIFICATION(core_pos), 0U);
+	} else {
+		ret = cactus_notification_unbind_send_cmd(
+			HYP_ID, receiver, receiver, VM_ID_OF(core_pos),
+			FFA_NOTIFICATION(core_pos));
+	}
+
+	return stress_direct_result(ret) == STRESS_OK;
+}
+
+/*
+ * Bind the notification of every core to each receiver, or unbind them,
+ * dropping the notifications still pending first. Return the number of
+ * bindings done, to undo them in case of failure.
+ */
+static unsigned int stress_notif_setup(unsigned int count, bool bind)
+{
+	unsigned int done = 0U;
+	struct ffa_value ret;
+
+	for (unsigned int t = 0U; t < ARRAY_SIZE(notif_targets); t++) {
+		if (!bind) {
+			ret = cactus_notification_get_send_cmd(
+				HYP_ID, notif_targets[t], notif_targets[t], 0U,
+				FFA_NOTIFICATIONS_FLAG_BITMAP_VM, false);
+			if (stress_direct_result(ret) != STRESS_OK) {
+				ERROR("Failed to drain the notifications of %x\n",
+				      notif_targets[t]);
+			}
+		}
+
+		for (unsigned int c = 0U; c < PLATFORM_CORE_COUNT; c++) {
+			if (done == count) {
+				return done;
+			}
+
+			if (!stress_notif_bind(notif_targets[t], c, bind)) {
+				ERROR("Failed to %s VM %x to %x\n",
+				      bind ? "bind" : "unbind", VM_ID_OF(c),
+				      notif_targets[t]);
+				return done;
+			}
+			done++;
+		}
+	}
+
+	return done;
+}
+
+static void stress_report(void)
+{
+	unsigned long long duration_ticks = (read_cntfrq_el0() *
+					     STRESS_DURATION_MS) / 1000U;
+	struct stress_counters total, all = { 0U };
+	unsigned long long core_ops;
+
+	tftf_testcase_printf("%s mix, %u ms:\n", mix->name, STRESS_DURATION_MS);
+
+	for (unsigned int op = 0U; op < STRESS_OPS; op++) {
+		memset(&total, 0, sizeof(total));
+
+		for (unsigned int c = 0U; c < PLATFORM_CORE_COUNT; c++) {
+			total.ok += cores[c].counters[op].ok;
+			total.busy += cores[c].counters[op].busy;
+			total.failed += cores[c].counters[op].failed;
+			total.ticks += cores[c].counters[op].ticks;
+		}
+
+		all.ok += total.ok;
+		all.busy += total.busy;
+		all.failed += total.failed;
+
+		if ((total.ok + total.busy + total.failed) == 0U) {
+			continue;
+		}
+
+		tftf_testcase_printf("  %s: %llu ok, %llu busy, %llu failed, %llu ops/s, avg %llu ns\n",
+				     op_names[op], total.ok, total.busy,
+				     total.failed,
+				     perf_ops_per_sec(total.ok, duration_ticks),
+				     perf_ticks_to_ns(total.ticks) /
+				     (total.ok + total.busy + total.failed));
+	}
+
+	tftf_testcase_printf("  total: %llu ok, %llu busy, %llu failed, %llu ops/s\n",
+			     all.ok, all.busy, all.failed,
+			     perf_ops_per_sec(all.ok, duration_ticks));
+
+	for (unsigned int c = 0U; c < PLATFORM_CORE_COUNT; c++) {
+		if (!mc_cpu[c]) {
+			continue;
+		}
+
+		core_ops = 0U;
+		for (unsigned int op = 0U; op < STRESS_OPS; op++) {
+			core_ops += cores[c].counters[op].ok;
+		}
+
+		tftf_testcase_printf("  core %u: %llu ok\n", c, core_ops);
+	}
+}
+
+/*
+ * Send the traffic of 'config' from all the cores for STRESS_DURATION_MS,
+ * then report the counters.
+ */
+static test_result_t stress_test(const struct stress_config *config)
+{
+	u_register_t lead_mpid = read_mpidr_el1() & MPID_MASK;
+	unsigned int lead_pos = platform_get_core_pos(lead_mpid);
+	test_result_t result = TEST_RESULT_SUCCESS;
+	unsigned int cpu_node, core_pos, bound;
+	struct ffa_partition_info info;
+	struct mailbox_buffers mb;
+	struct ffa_value ret;
+	u_register_t mpidr;
+	uint32_t count;
+	int psci_ret;
+
+	CHECK_SPMC_TESTING_SETUP(1, 2, expected_sp_uuids);
+	GET_TFTF_MAILBOX(mb);
+
+	mix = config;
+
+	/* Only send requests to Ivy if it is deployed */
+	if (!ffa_partition_info_cache_get(&mb, ivy_uuid, &info, 1U, &count)) {
+		return TEST_RESULT_FAIL;
+	}
+	echo_target_count = ARRAY_SIZE(echo_targets) - ((count == 0U) ? 1U : 0U);
+
+	ret = ffa_rxtx_map_forward(mb.send, STRESS_IND_MSG_SENDER,
+				   vm1_rx_buffer, vm1_tx_buffer);
+	if (!is_expected_ffa_return(ret, FFA_SUCCESS_SMC32)) {
+		ERROR("Failed to map buffers RX %p TX %p for VM %x\n",
+		      vm1_rx_buffer, vm1_tx_buffer, STRESS_IND_MSG_SENDER);
+		return TEST_RESULT_FAIL;
+	}
+
+	bound = stress_notif_setup(ARRAY_SIZE(notif_targets) *
+				   PLATFORM_CORE_COUNT, true);
+	if (bound != (ARRAY_SIZE(notif_targets) * PLATFORM_CORE_COUNT)) {
+		result = TEST_RESULT_FAIL;
+		goto out;
+	}
+
+	tftf_irq_register_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID,
+				  sri_handler);
+
+	memset(cores, 0, sizeof(cores));
+	memset(mc_cpu, 0, sizeof(mc_cpu));
+	mc_go = false;
+	mc_failed = false;
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		cores[i].seed = (i + 1U) * 0x9e3779b9U;
+		for (unsigned int op = 0U; op < STRESS_OPS; op++) {
+			/* Spread the cores over the targets */
+			cores[i].next_target[op] = i;
+		}
+		tftf_init_event(&mc_ready[i]);
+		tftf_init_event(&mc_done[i]);
+	}
+
+	for_each_cpu(cpu_node) {
+		mpidr = tftf_get_mpidr_from_node(cpu_node);
+		core_pos = platform_get_core_pos(mpidr);
+
+		if (mpidr != lead_mpid) {
+			psci_ret = tftf_cpu_on(mpidr,
+					       (uintptr_t)stress_mc_worker, 0U);
+			if (psci_ret != PSCI_E_SUCCESS) {
+				ERROR("tftf_cpu_on mpidr 0x%llx returns %d\n",
+				      (unsigned long long)mpidr, psci_ret);
+				mc_failed = true;
+				break;
+			}
+			tftf_wait_for_event(&mc_ready[core_pos]);
+		}
+
+		mc_cpu[core_pos] = true;
+	}
+
+	stress_deadline = syscounter_read() +
+			  ((read_cntfrq_el0() * STRESS_DURATION_MS) / 1000U);
+
+	/* Release the cores which are online, even if some failed to start */
+	dsbish();
+	mc_go = true;
+	dsbish();
+	sev();
+
+	stress_run(lead_pos);
+
+	for (core_pos = 0U; core_pos < PLATFORM_CORE_COUNT; core_pos++) {
+		if (mc_cpu[core_pos] && (core_pos != lead_pos)) {
+			tftf_wait_for_event(&mc_done[core_pos]);
+		}
+	}
+
+	tftf_irq_unregister_handler(FFA_SCHEDULE_RECEIVER_INTERRUPT_ID);
+
+	stress_report();
+
+	if (mc_failed) {
+		result = TEST_RESULT_FAIL;
+	}
+
+out:
+	if (stress_notif_setup(bound, false) != bound) {
+		result = TEST_RESULT_FAIL;
+	}
+
+	ret = ffa_rxtx_unmap_with_id(STRESS_IND_MSG_SENDER);
+	if (!is_expected_ffa_return(ret, FFA_SUCCESS_SMC32)) {
+		ERROR("Failed to unmap RXTX for vm %x\n",
+		      STRESS_IND_MSG_SENDER);
+		result = TEST_RESULT_FAIL;
+	}
+
+	return result;
+}
+
+/*
+ * @Test_Aim@ Stress the SPMC with an even mix of FF-A traffic from all the
+ * cores to all the SPs
+ *
+ * Report the number of operations which succeeded, were refused as busy and
+ * failed, per operation and per core. Fail if any operation failed.
+ */
+test_result_t test_ffa_stress_balanced(void)
+{
+	return stress_test(&balanced_mix);
+}
+
+/*
+ * @Test_Aim@ Stress the memory sharing ABIs of the SPMC from all the cores
+ *
+ * Same as test_ffa_stress_balanced(), with most of the traffic made of memory
+ * sharing cycles.
+ */
+test_result_t test_ffa_stress_memory(void)
+{
+	return stress_test(&memory_mix);
+}
+
+/*
+ * @Test_Aim@ Stress the messaging ABIs of the SPMC from all the cores
+ *
+ * Same as test_ffa_stress_balanced(), with direct requests, notifications and
+ * indirect messages only.
+ */
+test_result_t test_ffa_stress_messaging(void)
+{
+	return stress_test(&messaging_mix);
+}
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains benchmarks of the interrupt handling path of TFTF:
+ *  - the latency of an SGI between every pair of cores, from the time the
+ *    sender writes to the GIC to the time the handler runs on the receiver;
+ *  - the jitter of the timer framework interrupt, i.e. how late the timer
+ *    handler runs compared to the requested time;
+ *  - the cost of taking an interrupt on the local core, split between the
+ *    entry (exception entry, acknowledge and dispatch to the handler) and the
+ *    exit (end of interrupt and exception return).
+ *
+ * All the cores read the same system counter, so timestamps taken on
+ * different cores can be compared. Latencies are reported in nanoseconds as
+ * percentiles of the samples. The tests only fail when an interrupt is lost.
+ */
+
+#include <arch_helpers.h>
+#include <assert.h>
+#include <debug.h>
+#include <drivers/arm/arm_gic.h>
+#include <events.h>
+#include <irq.h>
+#include <plat_topology.h>
+#include <platform.h>
+#include <platform_def.h>
+#include <power_management.h>
+#include <psci.h>
+#include <stdbool.h>
+#include <tftf_lib.h>
+#include <timer.h>
+
+#include "perf_stats.h"
+
+#define SGI_LAT_ITERATIONS	100U
+#define TIMER_JITTER_ITERATIONS	200U
+#define TIMER_JITTER_PERIOD_US	500U
+#define DISPATCH_ITERATIONS	1000U
+#define IRQ_LAT_MAX_SAMPLES	1000U
+
+/* Give up waiting for an interrupt after this long */
+#define IRQ_LAT_TIMEOUT_MS	100U
+
+#define PING_SGI		IRQ_NS_SGI_0
+#define PONG_SGI		IRQ_NS_SGI_1
+
+static unsigned long long lat_samples[IRQ_LAT_MAX_SAMPLES];
+static unsigned long long exit_samples[IRQ_LAT_MAX_SAMPLES];
+
+static bool irq_lat_timed_out(unsigned long long start)
+{
+	return (syscounter_read() - start) >
+		((read_cntfrq_el0() * IRQ_LAT_TIMEOUT_MS) / 1000U);
+}
+
+/*
+ * SGI latency between each pair of cores.
+ *
+ * Every core runs sgi_latency_worker(). For each pair of cores, the lead CPU
+ * selects the sender and the receiver and starts a new round. The sender
+ * timestamps and sends PING_SGI to the receiver, whose handler timestamps its
+ * entry and answers with PONG_SGI, which lets the sender start the next
+ * iteration.
+ */
+static volatile unsigned int sgi_round;
+static volatile bool sgi_exit;
+static volatile unsigned int sgi_sender;
+static volatile unsigned int sgi_receiver;
+static volatile unsigned long long sgi_send_time;
+static volatile unsigned long long sgi_recv_time;
+static volatile bool sgi_pong_received;
+static volatile bool sgi_lost;
+
+static event_t cpu_ready[PLATFORM_CORE_COUNT];
+static event_t round_done;
+
+static struct perf_stats sgi_matrix[PLATFORM_CORE_COUNT][PLATFORM_CORE_COUNT];
+
+static int sgi_ping_handler(void *data)
+{
+	sgi_recv_time = syscounter_read();
+	tftf_send_sgi(PONG_SGI, sgi_sender);
+
+	return 0;
+}
+
+static int sgi_pong_handler(void *data)
+{
+	sgi_pong_received = true;
+
+	return 0;
+}
+
+static int sgi_latency_register_handlers(void)
+{
+	int ret;
+
+	ret = tftf_irq_register_handler_sgi(PING_SGI, sgi_ping_handler);
+	if (ret != 0)
+		return ret;
+
+	ret = tftf_irq_register_handler_sgi(PONG_SGI, sgi_pong_handler);
+	if (ret != 0) {
+		tftf_irq_unregister_handler_sgi(PING_SGI);
+		return ret;
+	}
+
+	tftf_irq_enable_sgi(PING_SGI, GIC_HIGHEST_NS_PRIORITY);
+	tftf_irq_enable_sgi(PONG_SGI, GIC_HIGHEST_NS_PRIORITY);
+
+	return 0;
+}
+
+static void sgi_latency_unregister_handlers(void)
+{
+	tftf_irq_disable_sgi(PING_SGI);
+	tftf_irq_disable_sgi(PONG_SGI);
+	tftf_irq_unregister_handler_sgi(PING_SGI);
+	tftf_irq_unregister_handler_sgi(PONG_SGI);
+}
+
+/* Measure the SGI latency from the calling core to 'receiver'. */
+static void sgi_latency_measure(unsigned int receiver,
+				struct perf_stats *stats)
+{
+	unsigned long long start;
+
+	for (unsigned int i = 0U; i < SGI_LAT_ITERATIONS; i++) {
+		sgi_pong_received = false;
+		sgi_send_time = syscounter_read();
+		tftf_send_sgi(PING_SGI, receiver);
+
+		start = syscounter_read();
+		while (!sgi_pong_received) {
+			if (irq_lat_timed_out(start)) {
+				sgi_lost = true;
+				return;
+			}
+		}
+
+		lat_samples[i] = sgi_recv_time - sgi_send_time;
+	}
+
+	perf_stats_compute(lat_samples, SGI_LAT_ITERATIONS, stats);
+}
+
+static test_result_t sgi_latency_worker(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	unsigned int round = 0U;
+
+	if (sgi_latency_register_handlers() != 0) {
+		tftf_testcase_printf("Failed to register SGI handlers\n");
+		return TEST_RESULT_FAIL;
+	}
+
+	tftf_send_event(&cpu_ready[core_pos]);
+
+	for (;;) {
+		while (sgi_round == round)
+			continue;
+
+		round = sgi_round;
+		/* Read the round parameters after the round number */
+		dmbish();
+
+		if (sgi_exit)
+			break;
+
+		if (sgi_sender == core_pos) {
+			sgi_latency_measure(sgi_receiver,
+					    &sgi_matrix[core_pos][sgi_receiver]);
+			tftf_send_event(&round_done);
+		}
+	}
+
+	sgi_latency_unregister_handlers();
+
+	return TEST_RESULT_SUCCESS;
+}
+
+static void sgi_latency_start_round(unsigned int sender, unsigned int receiver,
+				    bool exit)
+{
+	sgi_sender = sender;
+	sgi_receiver = receiver;
+	sgi_exit = exit;
+	/* Publish the round parameters before the round number */
+	dmbish();
+	sgi_round = sgi_round + 1U;
+	dsbish();
+	sev();
+}
+
+/*
+ * Print a latency matrix, sender in rows and receiver in columns, to the test
+ * output. It is kept compact so that both matrices of an 8-core platform fit
+ * in TESTCASE_OUTPUT_MAX_SIZE.
+ */
+static void sgi_latency_print_matrix(bool p99)
+{
+	unsigned int sender_node, receiver_node;
+	unsigned int sender, receiver;
+
+	tftf_testcase_printf("%s (ns)\n", p99 ? "p99" : "p50");
+	tftf_testcase_printf("%2s", "");
+	for_each_cpu(receiver_node) {
+		receiver = platform_get_core_pos(
+				tftf_get_mpidr_from_node(receiver_node));
+		tftf_testcase_printf(" %5u", receiver);
+	}
+	tftf_testcase_printf("\n");
+
+	for_each_cpu(sender_node) {
+		sender = platform_get_core_pos(
+				tftf_get_mpidr_from_node(sender_node));
+		tftf_testcase_printf("%2u", sender);
+		for_each_cpu(receiver_node) {
+			receiver = platform_get_core_pos(
+					tftf_get_mpidr_from_node(receiver_node));
+			tftf_testcase_printf(" %5llu", p99 ?
+					     sgi_matrix[sender][receiver].p99 :
+					     sgi_matrix[sender][receiver].p50);
+		}
+		tftf_testcase_printf("\n");
+	}
+}
+
+/*
+ * @Test_Aim@ Measure the SGI latency between every pair of cores
+ *
+ * Print the median and 99th percentile latency matrices, and the fastest and
+ * slowest pairs.
+ */
+test_result_t test_sgi_latency_matrix(void)
+{
+	u_register_t lead_mpid = read_mpidr_el1() & MPID_MASK;
+	unsigned int lead_pos = platform_get_core_pos(lead_mpid);
+	unsigned int sender_node, receiver_node, target_node;
+	unsigned int sender, receiver, core_pos;
+	/* Pairs with the lowest and highest median, the lead CPU is measured */
+	unsigned int best_s = lead_pos, best_r = lead_pos;
+	unsigned int worst_s = lead_pos, worst_r = lead_pos;
+	u_register_t target_mpid;
+	int ret;
+
+	sgi_round = 0U;
+	sgi_exit = false;
+	sgi_lost = false;
+	tftf_init_event(&round_done);
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++)
+		tftf_init_event(&cpu_ready[i]);
+
+	if (sgi_latency_register_handlers() != 0) {
+		tftf_testcase_printf("Failed to register SGI handlers\n");
+		return TEST_RESULT_FAIL;
+	}
+
+	for_each_cpu(target_node) {
+		target_mpid = tftf_get_mpidr_from_node(target_node);
+		if (target_mpid == lead_mpid)
+			continue;
+
+		ret = tftf_cpu_on(target_mpid, (uintptr_t)sgi_latency_worker, 0);
+		if (ret != PSCI_E_SUCCESS) {
+			tftf_testcase_printf("Failed to power on CPU 0x%llx (%d)\n",
+					(unsigned long long)target_mpid, ret);
+			sgi_latency_start_round(0U, 0U, true);
+			sgi_latency_unregister_handlers();
+			return TEST_RESULT_FAIL;
+		}
+
+		core_pos = platform_get_core_pos(target_mpid);
+		tftf_wait_for_event(&cpu_ready[core_pos]);
+	}
+
+	for_each_cpu(sender_node) {
+		sender = platform_get_core_pos(
+				tftf_get_mpidr_from_node(sender_node));
+
+		for_each_cpu(receiver_node) {
+			receiver = platform_get_core_pos(
+					tftf_get_mpidr_from_node(receiver_node));
+
+			sgi_latency_start_round(sender, receiver, false);
+			if (sender == lead_pos) {
+				sgi_latency_measure(receiver,
+						    &sgi_matrix[sender][receiver]);
+			} else {
+				tftf_wait_for_event(&round_done);
+			}
+
+			if (sgi_lost) {
+				tftf_testcase_printf("SGI from core %u to core %u lost\n",
+						     sender, receiver);
+				goto exit;
+			}
+
+			if (sgi_matrix[sender][receiver].p50 <
+			    sgi_matrix[best_s][best_r].p50) {
+				best_s = sender;
+				best_r = receiver;
+			}
+			if (sgi_matrix[sender][receiver].p50 >
+			    sgi_matrix[worst_s][worst_r].p50) {
+				worst_s = sender;
+				worst_r = receiver;
+			}
+		}
+	}
+
+	sgi_latency_print_matrix(false);
+	sgi_latency_print_matrix(true);
+	tftf_testcase_printf("Fastest %u->%u, slowest %u->%u\n",
+			     best_s, best_r, worst_s, worst_r);
+
+exit:
+	sgi_latency_start_round(0U, 0U, true);
+	sgi_latency_unregister_handlers();
+
+	return sgi_lost ? TEST_RESULT_FAIL : TEST_RESULT_SUCCESS;
+}
+
+/*
+ * Timer interrupt jitter.
+ */
+static volatile unsigned long long timer_fire_time;
+static volatile bool timer_fired;
+
+static int timer_jitter_handler(void *data)
+{
+	timer_fire_time = syscounter_read();
+	timer_fired = true;
+
+	return 0;
+}
+
+/*
+ * @Test_Aim@ Measure how late the timer framework interrupt is handled
+ *
+ * Program the timer TIMER_JITTER_ITERATIONS times and record the delay
+ * between the requested expiry time and the entry in the timer handler.
+ */
+test_result_t test_timer_irq_jitter(void)
+{
+	unsigned long long period, start, deadline;
+	struct perf_stats stats;
+	test_result_t ret = TEST_RESULT_SUCCESS;
+	unsigned int i;
+
+	period = (read_cntfrq_el0() * TIMER_JITTER_PERIOD_US) / 1000000U;
+
+	tftf_timer_register_handler(timer_jitter_handler);
+
+	for (i = 0U; i < TIMER_JITTER_ITERATIONS; i++) {
+		timer_fired = false;
+		deadline = syscounter_read() + period;
+
+		if (tftf_program_timer_us(TIMER_JITTER_PERIOD_US) != 0) {
+			tftf_testcase_printf("Failed to program the timer\n");
+			ret = TEST_RESULT_FAIL;
+			break;
+		}
+
+		start = syscounter_read();
+		while (!timer_fired) {
+			if (irq_lat_timed_out(start)) {
+				tftf_testcase_printf("Timer interrupt lost\n");
+				tftf_cancel_timer();
+				ret = TEST_RESULT_FAIL;
+				break;
+			}
+		}
+
+		if (ret != TEST_RESULT_SUCCESS)
+			break;
+
+		/* The interrupt can't fire before the deadline */
+		if (timer_fire_time < deadline) {
+			tftf_testcase_printf("Timer interrupt %llu ns early\n",
+				perf_ticks_to_ns(deadline - timer_fire_time));
+			ret = TEST_RESULT_FAIL;
+			break;
+		}
+
+		lat_samples[i] = timer_fire_time - deadline;
+	}
+
+	tftf_timer_unregister_handler();
+
+	if (ret != TEST_RESULT_SUCCESS)
+		return ret;
+
+	perf_stats_compute(lat_samples, TIMER_JITTER_ITERATIONS, &stats);
+	perf_stats_print("Timer interrupt lateness", &stats);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * Interrupt dispatch overhead.
+ */
+static volatile unsigned long long dispatch_entry_time;
+
+static int dispatch_handler(void *data)
+{
+	dispatch_entry_time = syscounter_read();
+
+	return 0;
+}
+
+/*
+ * @Test_Aim@ Measure the cost of taking an interrupt
+ *
+ * With interrupts masked, make an SGI pending on the calling core, then
+ * unmask interrupts. The time from unmasking to the entry in the handler is
+ * the entry cost, from the handler to the instruction after the unmasking the
+ * exit cost.
+ */
+test_result_t test_irq_dispatch_overhead(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+	unsigned int sgi_irq = tftf_irq_get_my_sgi_num(PING_SGI);
+	unsigned long long start, unmask_time, resume_time;
+	struct perf_stats stats;
+	test_result_t ret = TEST_RESULT_SUCCESS;
+	unsigned int i;
+
+	if (tftf_irq_register_handler_sgi(PING_SGI, dispatch_handler) != 0) {
+		tftf_testcase_printf("Failed to register SGI handler\n");
+		return TEST_RESULT_FAIL;
+	}
+	tftf_irq_enable_sgi(PING_SGI, GIC_HIGHEST_NS_PRIORITY);
+
+	for (i = 0U; i < DISPATCH_ITERATIONS; i++) {
+		disable_irq();
+
+		dispatch_entry_time = 0U;
+		tftf_send_sgi(PING_SGI, core_pos);
+
+		/* Make sure the interrupt is taken as soon as it is unmasked */
+		start = syscounter_read();
+		while (arm_gic_is_intr_pending(sgi_irq) == 0U) {
+			if (irq_lat_timed_out(start))
+				break;
+		}
+
+		unmask_time = syscounter_read();
+		enable_irq();
+		resume_time = syscounter_read();
+
+		if (dispatch_entry_time == 0U) {
+			tftf_testcase_printf("SGI lost\n");
+			ret = TEST_RESULT_FAIL;
+			break;
+		}
+
+		lat_samples[i] = dispatch_entry_time - unmask_time;
+		exit_samples[i] = resume_time - dispatch_entry_time;
+	}
+
+	tftf_irq_disable_sgi(PING_SGI);
+	tftf_irq_unregister_handler_sgi(PING_SGI);
+
+	if (ret != TEST_RESULT_SUCCESS)
+		return ret;
+
+	perf_stats_compute(lat_samples, DISPATCH_ITERATIONS, &stats);
+	perf_stats_print("Interrupt entry", &stats);
+	perf_stats_compute(exit_samples, DISPATCH_ITERATIONS, &stats);
+	perf_stats_print("Interrupt exit", &stats);
+
+	return TEST_RESULT_SUCCESS;
+}
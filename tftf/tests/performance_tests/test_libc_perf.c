@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * This file contains a benchmark of the memory and string functions of the
+ * bundled libc. Each function is run on buffers ranging from 1 byte to 1 MiB,
+ * either word-aligned or misaligned, and the average time per call and the
+ * resulting throughput are printed.
+ */
+
+#include <arch_features.h>
+#include <arch_helpers.h>
+#include <common_def.h>
+#include <debug.h>
+#include <string.h>
+#include <tftf_lib.h>
+#include <utils_def.h>
+#include <xlat_tables_defs.h>
+
+#include "perf_stats.h"
+
+#define LIBC_PERF_MAX_SIZE	SZ_1M
+
+/* Amount of data processed for each function and size. */
+#define LIBC_PERF_BYTES		SZ_4M
+#define LIBC_PERF_MAX_ITER	1000U
+
+static __aligned(PAGE_SIZE) uint8_t src_buf[LIBC_PERF_MAX_SIZE + 16U];
+static __aligned(PAGE_SIZE) uint8_t dst_buf[LIBC_PERF_MAX_SIZE + 16U];
+
+/* Function under test, called with a 'size' bytes long string as 'src'. */
+struct libc_perf_func {
+	const char *name;
+	size_t (*run)(uint8_t *dst, const uint8_t *src, size_t size,
+		      unsigned int iter);
+};
+
+static size_t run_memcpy(uint8_t *dst, const uint8_t *src, size_t size,
+			 unsigned int iter)
+{
+	(void)iter;
+
+	memcpy(dst, src, size);
+	return 0U;
+}
+
+static size_t run_memset(uint8_t *dst, const uint8_t *src, size_t size,
+			 unsigned int iter)
+{
+	(void)src;
+
+	memset(dst, (int)iter, size);
+	return 0U;
+}
+
+static size_t run_memcmp(uint8_t *dst, const uint8_t *src, size_t size,
+			 unsigned int iter)
+{
+	(void)iter;
+
+	return (size_t)memcmp(dst, src, size);
+}
+
+static size_t run_strlen(uint8_t *dst, const uint8_t *src, size_t size,
+			 unsigned int iter)
+{
+	(void)dst;
+	(void)size;
+	(void)iter;
+
+	return strlen((const char *)src);
+}
+
+static size_t run_memcpy_generic(uint8_t *dst, const uint8_t *src,
+				 size_t size, unsigned int iter)
+{
+	(void)iter;
+
+	memcpy_generic(dst, src, size);
+	return 0U;
+}
+
+static size_t run_memset_generic(uint8_t *dst, const uint8_t *src,
+				 size_t size, unsigned int iter)
+{
+	(void)src;
+
+	memset_generic(dst, (int)iter, size);
+	return 0U;
+}
+
+#ifdef __aarch64__
+static size_t run_memcpy_mops(uint8_t *dst, const uint8_t *src, size_t size,
+			      unsigned int iter)
+{
+	(void)iter;
+
+	memcpy_mops(dst, src, size);
+	return 0U;
+}
+
+static size_t run_memset_mops(uint8_t *dst, const uint8_t *src, size_t size,
+			      unsigned int iter)
+{
+	(void)src;
+
+	memset_mops(dst, (int)iter, size);
+	return 0U;
+}
+#endif
+
+static const struct libc_perf_func libc_funcs[] = {
+	{ "memcpy", run_memcpy },
+	{ "memset", run_memset },
+	{ "memcmp", run_memcmp },
+	{ "strlen", run_strlen },
+};
+
+#ifdef __aarch64__
+static const struct libc_perf_func mops_funcs[] = {
+	{ "memcpy generic", run_memcpy_generic },
+	{ "memcpy MOPS", run_memcpy_mops },
+	{ "memset generic", run_memset_generic },
+	{ "memset MOPS", run_memset_mops },
+};
+#endif
+
+/*
+ * Sizes of the buffers passed to the functions. Only a few of them are printed
+ * to keep the output of each test case within TESTCASE_OUTPUT_MAX_SIZE.
+ */
+static const size_t libc_perf_sizes[] = {
+	1U, 64U, SZ_4K, LIBC_PERF_MAX_SIZE
+};
+
+/*
+ * Run the given function on 'size' bytes 'iterations' times and return the
+ * total number of system counter ticks spent.
+ */
+static unsigned long long libc_perf_run(const struct libc_perf_func *func,
+					uint8_t *dst, const uint8_t *src,
+					size_t size, unsigned int iterations)
+{
+	unsigned long long ticks;
+	volatile size_t res = 0U;
+
+	ticks = read_cntpct_el0();
+	for (unsigned int i = 0U; i < iterations; i++) {
+		res += func->run(dst, src, size, i);
+	}
+	ticks = read_cntpct_el0() - ticks;
+
+	(void)res;
+
+	return ticks;
+}
+
+static void libc_perf_measure(const struct libc_perf_func *funcs,
+			      unsigned int funcs_num, size_t offset)
+{
+	tftf_testcase_printf("Source offset %lu\n", (unsigned long)offset);
+	tftf_testcase_printf("%-14s %7s %9s %7s\n", "function", "size",
+			     "ns/call", "MiB/s");
+
+	for (unsigned int f = 0U; f < funcs_num; f++) {
+		for (unsigned int s = 0U; s < ARRAY_SIZE(libc_perf_sizes); s++) {
+			size_t size = libc_perf_sizes[s];
+			const uint8_t *src = src_buf + offset;
+			unsigned int iterations;
+			unsigned long long ticks;
+
+			iterations = MIN((size_t)LIBC_PERF_MAX_ITER,
+					 MAX((size_t)1U,
+					     LIBC_PERF_BYTES / size));
+
+			/*
+			 * Make the source a string of 'size' characters and
+			 * the destination identical to it, so that memcmp()
+			 * and strlen() go through the whole buffer.
+			 */
+			memset(src_buf, 'a', sizeof(src_buf));
+			src_buf[offset + size] = '\0';
+			memcpy(dst_buf, src, size);
+
+			ticks = libc_perf_run(&funcs[f], dst_buf, src, size,
+					      iterations);
+			if (ticks == 0ULL) {
+				ticks = 1ULL;
+			}
+
+			tftf_testcase_printf("%-14s %7lu %9llu %7llu\n",
+				funcs[f].name, (unsigned long)size,
+				perf_ticks_to_ns(ticks) / iterations,
+				perf_ops_per_sec((unsigned long long)size *
+						 iterations, ticks) / SZ_1M);
+		}
+	}
+}
+
+/*
+ * Measure the performance of the libc memory and string functions for sizes
+ * from 1 byte to 1 MiB with word-aligned buffers. This test always succeeds.
+ */
+test_result_t test_libc_mem_functions_perf(void)
+{
+	libc_perf_measure(libc_funcs, ARRAY_SIZE(libc_funcs), 0U);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * Same as test_libc_mem_functions_perf() with a source buffer that is not
+ * word-aligned. This test always succeeds.
+ */
+test_result_t test_libc_mem_functions_misaligned_perf(void)
+{
+	libc_perf_measure(libc_funcs, ARRAY_SIZE(libc_funcs), 1U);
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * Check that the FEAT_MOPS instructions can be used by the benchmark. They are
+ * only measured when TFTF runs at NS-EL2, where they can't be trapped.
+ */
+static test_result_t libc_mops_perf(size_t offset)
+{
+#ifdef __aarch64__
+	if (!is_feat_mops_present()) {
+		tftf_testcase_printf("FEAT_MOPS not supported\n");
+		return TEST_RESULT_SKIPPED;
+	}
+
+	if (!IS_IN_EL2()) {
+		tftf_testcase_printf("FEAT_MOPS may be trapped at NS-EL1\n");
+		return TEST_RESULT_SKIPPED;
+	}
+
+	libc_perf_measure(mops_funcs, ARRAY_SIZE(mops_funcs), offset);
+
+	return TEST_RESULT_SUCCESS;
+#else
+	(void)offset;
+
+	tftf_testcase_printf("FEAT_MOPS is only supported in AArch64\n");
+	return TEST_RESULT_SKIPPED;
+#endif
+}
+
+/*
+ * Compare the generic and FEAT_MOPS implementations of memcpy() and memset()
+ * for sizes from 1 byte to 1 MiB with word-aligned buffers. This test always
+ * succeeds when FEAT_MOPS is implemented and TFTF runs at NS-EL2.
+ */
+test_result_t test_libc_mops_perf(void)
+{
+	return libc_mops_perf(0U);
+}
+
+/*
+ * Same as test_libc_mops_perf() with a source buffer that is not word-aligned.
+ */
+test_result_t test_libc_mops_misaligned_perf(void)
+{
+	return libc_mops_perf(1U);
+}
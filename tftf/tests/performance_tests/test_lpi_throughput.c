@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Benchmarks of the LPI injection rate through the GICv3 ITS, either with INT
+ * commands or with writes to GITS_TRANSLATER, the way a device signals an
+ * MSI.
+ *
+ * Each round makes all the LPIs available to the driver pending with
+ * interrupts masked, then unmasks them and waits for all of them to be
+ * handled. Distinct LPIs are used so that none of them is merged with
+ * another injection of itself. Two rates are reported: the injection rate,
+ * i.e. how fast the CPU can hand the LPIs over to the ITS, and the delivery
+ * rate, from the first injection to the last LPI being handled.
+ */
+
+#include <arch_helpers.h>
+#include <debug.h>
+#include <drivers/arm/arm_gic.h>
+#include <drivers/arm/gic_v2v3_common.h>
+#include <drivers/arm/gic_v3_its.h>
+#include <irq.h>
+#include <mmio.h>
+#include <platform.h>
+#include <platform_def.h>
+#include <stdbool.h>
+#include <tftf_lib.h>
+
+#define LPI_COUNT		((MAX_LPI_ID + 1) - MIN_LPI_ID)
+#define LPI_ROUNDS		100U
+
+/* Give up waiting for the LPIs of a round after this long */
+#define LPI_TIMEOUT_MS		100U
+
+#if GICV3_ITS && defined(PLAT_ARM_GITS_BASE)
+
+#define LPI_DEVICE_ID		PLAT_ARM_GITS_CPU_DEVICE_ID
+
+static volatile unsigned int lpis_received;
+
+static int lpi_handler(void *data)
+{
+	lpis_received++;
+	return 0;
+}
+
+static void inject_with_int(unsigned int event_id)
+{
+	gicv3_its_inject_lpi(MIN_LPI_ID + event_id);
+}
+
+static void inject_with_translater(unsigned int event_id)
+{
+	mmio_write_32(gicv3_its_get_translater(), event_id);
+}
+
+/* Undo the setup of the first `count` LPIs */
+static void lpi_teardown(unsigned int count)
+{
+	for (unsigned int i = 0U; i < count; i++) {
+		gicv3_its_lpi_disable(MIN_LPI_ID + i);
+		tftf_irq_unregister_handler(MIN_LPI_ID + i);
+	}
+
+	gicv3_its_unmap_device(LPI_DEVICE_ID);
+}
+
+/*
+ * Map event i of the device to LPI MIN_LPI_ID + i, targeting the calling
+ * core.
+ */
+static test_result_t lpi_setup(void)
+{
+	unsigned int core_pos = platform_get_core_pos(read_mpidr_el1());
+
+	if (arm_gic_get_version() != 3) {
+		tftf_testcase_printf("GICv3 required\n");
+		return TEST_RESULT_SKIPPED;
+	}
+
+	if (gicv3_its_init(PLAT_ARM_GITS_BASE) != 0) {
+		tftf_testcase_printf("No usable ITS\n");
+		return TEST_RESULT_SKIPPED;
+	}
+
+	if ((gicv3_its_setup_local() != 0) ||
+	    (gicv3_its_map_device(LPI_DEVICE_ID, LPI_COUNT) != 0)) {
+		return TEST_RESULT_FAIL;
+	}
+
+	for (unsigned int i = 0U; i < LPI_COUNT; i++) {
+		if (gicv3_its_map_lpi(LPI_DEVICE_ID, i, MIN_LPI_ID + i,
+				      core_pos) != 0) {
+			lpi_teardown(i);
+			return TEST_RESULT_FAIL;
+		}
+
+		if (tftf_irq_register_handler(MIN_LPI_ID + i,
+					      lpi_handler) != 0) {
+			lpi_teardown(i);
+			return TEST_RESULT_FAIL;
+		}
+
+		gicv3_its_lpi_enable(MIN_LPI_ID + i, GIC_HIGHEST_NS_PRIORITY);
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/* Wait for `count` LPIs in total, return the counter value at that time */
+static bool lpi_wait(unsigned int count, unsigned long long *end)
+{
+	unsigned long long start = syscounter_read();
+	unsigned long long timeout =
+		(read_cntfrq_el0() * LPI_TIMEOUT_MS) / 1000U;
+
+	while (lpis_received < count) {
+		if ((syscounter_read() - start) > timeout)
+			return false;
+	}
+
+	*end = syscounter_read();
+	return true;
+}
+
+static unsigned long long lpis_per_sec(unsigned long long cycles)
+{
+	if (cycles == 0U)
+		return 0U;
+
+	return ((unsigned long long)LPI_COUNT * LPI_ROUNDS *
+		read_cntfrq_el0()) / cycles;
+}
+
+static test_result_t lpi_measure(const char *name,
+				 void (*inject)(unsigned int event_id))
+{
+	unsigned long long start, injected, end;
+	unsigned long long inject_cycles = 0U, deliver_cycles = 0U;
+
+	lpis_received = 0U;
+
+	for (unsigned int round = 0U; round < LPI_ROUNDS; round++) {
+		disable_irq();
+
+		start = syscounter_read();
+		for (unsigned int i = 0U; i < LPI_COUNT; i++)
+			inject(i);
+		injected = syscounter_read();
+
+		enable_irq();
+
+		if (!lpi_wait((round + 1U) * LPI_COUNT, &end)) {
+			tftf_testcase_printf("%s: %u LPIs lost in round %u\n",
+				name, ((round + 1U) * LPI_COUNT) -
+				lpis_received, round);
+			return TEST_RESULT_FAIL;
+		}
+
+		inject_cycles += injected - start;
+		deliver_cycles += end - start;
+	}
+
+	tftf_testcase_printf("%s: injection %llu LPIs/s, delivery %llu LPIs/s\n",
+			     name, lpis_per_sec(inject_cycles),
+			     lpis_per_sec(deliver_cycles));
+
+	return TEST_RESULT_SUCCESS;
+}
+
+/*
+ * @Test_Aim@ Measure the rate at which LPIs can be generated with ITS INT
+ * commands and handled on the same core.
+ */
+test_result_t test_lpi_throughput_its_int(void)
+{
+	test_result_t ret = lpi_setup();
+
+	if (ret != TEST_RESULT_SUCCESS)
+		return ret;
+
+	ret = lpi_measure("ITS INT", inject_with_int);
+
+	lpi_teardown(LPI_COUNT);
+	return ret;
+}
+
+/*
+ * @Test_Aim@ Measure the rate at which LPIs can be generated with writes to
+ * GITS_TRANSLATER and handled on the same core.
+ *
+ * The DeviceID of the writes of the CPU is set by the interconnect. The test
+ * is skipped if it is not PLAT_ARM_GITS_CPU_DEVICE_ID, i.e. if a first write
+ * does not raise the expected LPI.
+ */
+test_result_t test_lpi_throughput_translater(void)
+{
+	unsigned long long end;
+	test_result_t ret = lpi_setup();
+
+	if (ret != TEST_RESULT_SUCCESS)
+		return ret;
+
+	lpis_received = 0U;
+	inject_with_translater(0U);
+	if (!lpi_wait(1U, &end)) {
+		tftf_testcase_printf("CPU writes to GITS_TRANSLATER don't "
+				     "come from DeviceID 0x%x\n",
+				     LPI_DEVICE_ID);
+		lpi_teardown(LPI_COUNT);
+		return TEST_RESULT_SKIPPED;
+	}
+
+	ret = lpi_measure("GITS_TRANSLATER", inject_with_translater);
+
+	lpi_teardown(LPI_COUNT);
+	return ret;
+}
+
+#else /* GICV3_ITS && PLAT_ARM_GITS_BASE */
+
+test_result_t test_lpi_throughput_its_int(void)
+{
+	tftf_testcase_printf("No ITS on this platform or GICV3_ITS=0\n");
+	return TEST_RESULT_SKIPPED;
+}
+
+test_result_t test_lpi_throughput_translater(void)
+{
+	tftf_testcase_printf("No ITS on this platform or GICV3_ITS=0\n");
+	return TEST_RESULT_SKIPPED;
+}
+
+#endif /* GICV3_ITS && PLAT_ARM_GITS_BASE */
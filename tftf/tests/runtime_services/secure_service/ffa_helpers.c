@@ -1,9 +1,10 @@
 /*
- * Copyright (c) 2018-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 #include <assert.h>
+#include <stdlib.h>
 
 #include <ffa_endpoints.h>
 #include <ffa_helpers.h>
@@ -328,6 +329,141 @@ uint32_t ffa_memory_fragment_init(
 	return constituent_count - count_to_copy;
 }
 
+static uintptr_t constituent_base(
+	const struct ffa_memory_region_constituent *constituent)
+{
+	return (uintptr_t)constituent->address;
+}
+
+static uintptr_t constituent_end(
+	const struct ffa_memory_region_constituent *constituent)
+{
+	return constituent_base(constituent) +
+	       ((uintptr_t)constituent->page_count * PAGE_SIZE_4KB);
+}
+
+static int constituent_cmp(const void *a, const void *b)
+{
+	uintptr_t x = constituent_base(a);
+	uintptr_t y = constituent_base(b);
+
+	return (x > y) - (x < y);
+}
+
+static int page_cmp(const void *a, const void *b)
+{
+	uintptr_t x = *(const uintptr_t *)a;
+	uintptr_t y = *(const uintptr_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/**
+ * Sorts the given constituents by address and merges the ones which are
+ * physically contiguous, in place. Overlapping constituents are left as they
+ * are, for the SPMC to reject them.
+ *
+ * Returns the number of constituents left at the start of `constituents`.
+ */
+uint32_t ffa_memory_constituents_coalesce(
+	struct ffa_memory_region_constituent constituents[],
+	uint32_t constituent_count)
+{
+	uint32_t merged;
+
+	if (constituent_count < 2U) {
+		return constituent_count;
+	}
+
+	qsort(constituents, constituent_count, sizeof(constituents[0]),
+	      constituent_cmp);
+
+	merged = 0U;
+	for (uint32_t i = 1U; i < constituent_count; i++) {
+		struct ffa_memory_region_constituent *last =
+			&constituents[merged];
+
+		if ((constituent_end(last) == constituent_base(&constituents[i])) &&
+		    (constituents[i].page_count <=
+		     (UINT32_MAX - last->page_count))) {
+			last->page_count += constituents[i].page_count;
+		} else {
+			constituents[++merged] = constituents[i];
+		}
+	}
+
+	return merged + 1U;
+}
+
+/**
+ * Builds the constituents describing the `page_count` 4 kiB pages at the
+ * addresses in `pages`, given in any order, with as few constituents as
+ * possible. `pages` is sorted in place.
+ *
+ * Returns the number of constituents written to `constituents`, or 0 if the
+ * pages don't fit in `constituents_max` constituents once merged.
+ */
+uint32_t ffa_memory_constituents_from_pages(
+	struct ffa_memory_region_constituent constituents[],
+	uint32_t constituents_max, uintptr_t pages[], uint32_t page_count)
+{
+	uint32_t count = 0U;
+
+	/*
+	 * Sort the pages first so that each run of consecutive pages is seen
+	 * in one go, and only then check the number of constituents needed.
+	 */
+	qsort(pages, page_count, sizeof(pages[0]), page_cmp);
+
+	for (uint32_t i = 0U; i < page_count; i++) {
+		assert((pages[i] & (PAGE_SIZE_4KB - 1U)) == 0U);
+
+		if ((count != 0U) &&
+		    (constituent_end(&constituents[count - 1U]) == pages[i]) &&
+		    (constituents[count - 1U].page_count < UINT32_MAX)) {
+			constituents[count - 1U].page_count++;
+			continue;
+		}
+
+		if (count == constituents_max) {
+			return 0U;
+		}
+
+		constituents[count].address = (void *)pages[i];
+		constituents[count].page_count = 1U;
+		constituents[count].reserved = 0U;
+		count++;
+	}
+
+	return count;
+}
+
+/**
+ * Same as `ffa_memory_region_init`, but coalesces the constituents first, in
+ * place. `constituent_count` is updated with the number of constituents left,
+ * which the remaining fragments are to be built from.
+ */
+uint32_t ffa_memory_region_init_coalesced(
+	struct ffa_memory_region *memory_region, size_t memory_region_max_size,
+	ffa_id_t sender, struct ffa_memory_access receivers[],
+	uint32_t receiver_count,
+	struct ffa_memory_region_constituent constituents[],
+	uint32_t *constituent_count, uint32_t tag,
+	ffa_memory_region_flags_t flags, enum ffa_memory_type type,
+	enum ffa_memory_cacheability cacheability,
+	enum ffa_memory_shareability shareability, uint32_t *total_length,
+	uint32_t *fragment_length)
+{
+	*constituent_count = ffa_memory_constituents_coalesce(
+		constituents, *constituent_count);
+
+	return ffa_memory_region_init(
+		memory_region, memory_region_max_size, sender, receivers,
+		receiver_count, constituents, *constituent_count, tag, flags,
+		type, cacheability, shareability, total_length,
+		fragment_length);
+}
+
 /**
  * Initialises the given `ffa_memory_region` to be used for an
  * `FFA_MEM_RETRIEVE_REQ` by the receiver of a memory transaction.
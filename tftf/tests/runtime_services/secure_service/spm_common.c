@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,6 +13,7 @@
 #include <assert.h>
 #include <ffa_svc.h>
 #include <lib/extensions/sve.h>
+#include <spinlock.h>
 #include <spm_common.h>
 #include <xlat_tables_v2.h>
 
@@ -312,7 +313,7 @@ bool memory_retrieve(struct mailbox_buffers *mb,
 		return false;
 	}
 
-	if (fragment_size > PAGE_SIZE) {
+	if (fragment_size > mb->size) {
 		ERROR("Fragment should be smaller than RX buffer!\n");
 		return false;
 	}
@@ -462,7 +463,7 @@ bool hypervisor_retrieve_request(struct mailbox_buffers *mb, uint64_t handle,
 		total_size, fragment_size, fragment_offset);
 
 	if (out != NULL) {
-		if (fragment_size > PAGE_SIZE) {
+		if (fragment_size > mb->size) {
 			ERROR("Fragment should be smaller than RX buffer!\n");
 			return false;
 		}
@@ -517,7 +518,7 @@ bool memory_relinquish(struct ffa_mem_relinquish *m, uint64_t handle,
 }
 
 bool send_fragmented_memory_region(
-	void *send_buffer,
+	void *send_buffer, size_t send_buffer_size,
 	const struct ffa_memory_region_constituent constituents[],
 	uint32_t constituent_count, uint32_t remaining_constituent_count,
 	uint32_t sent_length, uint32_t total_length, bool allocator_is_spmc,
@@ -557,7 +558,7 @@ bool send_fragmented_memory_region(
 		}
 
 		remaining_constituent_count = ffa_memory_fragment_init(
-			send_buffer, PAGE_SIZE,
+			send_buffer, send_buffer_size,
 			constituents + constituent_count -
 				remaining_constituent_count,
 			remaining_constituent_count, &fragment_length);
@@ -601,7 +602,7 @@ bool send_fragmented_memory_region(
  * Helper to call memory send function whose func id is passed as a parameter.
  */
 ffa_memory_handle_t memory_send(
-	void *send_buffer, uint32_t mem_func,
+	void *send_buffer, size_t send_buffer_size, uint32_t mem_func,
 	const struct ffa_memory_region_constituent *constituents,
 	uint32_t constituent_count, uint32_t remaining_constituent_count,
 	uint32_t fragment_length, uint32_t total_length,
@@ -636,9 +637,9 @@ ffa_memory_handle_t memory_send(
 	}
 
 	if (!send_fragmented_memory_region(
-		    send_buffer, constituents, constituent_count,
-		    remaining_constituent_count, fragment_length, total_length,
-		    true, ret)) {
+		    send_buffer, send_buffer_size, constituents,
+		    constituent_count, remaining_constituent_count,
+		    fragment_length, total_length, true, ret)) {
 		return FFA_MEMORY_HANDLE_INVALID;
 	}
 
@@ -671,9 +672,10 @@ ffa_memory_handle_t memory_init_and_send(
 		FFA_MEMORY_CACHE_WRITE_BACK, FFA_MEMORY_INNER_SHAREABLE,
 		&total_length, &fragment_length);
 
-	return memory_send(send_buffer, mem_func, constituents,
-			   constituents_count, remaining_constituent_count,
-			   fragment_length, total_length, ret);
+	return memory_send(send_buffer, memory_region_max_size, mem_func,
+			   constituents, constituents_count,
+			   remaining_constituent_count, fragment_length,
+			   total_length, ret);
 }
 
 static bool ffa_uuid_equal(const struct ffa_uuid uuid1,
@@ -875,6 +877,234 @@ bool ffa_partition_info_helper(struct mailbox_buffers *mb,
 	return result;
 }
 
+/*
+ * Discovery cache of the information of all the partitions, as returned for
+ * the NULL UUID, so that partitions can be looked up by UUID without a call
+ * to the SPMC nor a transfer of the ownership of the RX buffer. It is filled
+ * by the first lookup and kept until it is explicitly invalidated.
+ */
+static struct ffa_partition_info part_info_cache[FFA_PARTITION_INFO_CACHE_MAX];
+static uint32_t part_info_cache_count;
+static bool part_info_cache_valid;
+static spinlock_t part_info_cache_lock;
+
+/*
+ * Fill the cache with FFA_PARTITION_INFO_GET_REGS, continuing from the index
+ * following the last descriptor returned by each invocation, with the tag the
+ * SPMC returned to detect a change of the partitions in between.
+ */
+static bool ffa_partition_info_cache_fill_regs(void)
+{
+	uint16_t start_idx = 0U, tag = 0U, last_idx, curr_idx;
+	struct ffa_value ret;
+
+	do {
+		ret = ffa_partition_info_get_regs(NULL_UUID, start_idx, tag);
+		if (ffa_func_id(ret) != FFA_SUCCESS_SMC64) {
+			return false;
+		}
+
+		last_idx = ffa_partition_info_regs_get_last_idx(ret);
+		curr_idx = ffa_partition_info_regs_get_curr_idx(ret);
+
+		if (ffa_partition_info_regs_entry_size(ret) !=
+		    sizeof(struct ffa_partition_info)) {
+			ERROR("Unexpected partition info descriptor size %d\n",
+			      ffa_partition_info_regs_entry_size(ret));
+			return false;
+		}
+
+		if ((last_idx >= FFA_PARTITION_INFO_CACHE_MAX) ||
+		    (curr_idx < start_idx) || (curr_idx > last_idx) ||
+		    (ffa_partition_info_regs_entry_count(ret, start_idx) >
+		     MAX_INFO_REGS_ENTRIES_PER_CALL)) {
+			ERROR("Unexpected partition info indices %u-%u/%u\n",
+			      start_idx, curr_idx, last_idx);
+			return false;
+		}
+
+		for (uint16_t i = start_idx; i <= curr_idx; i++) {
+			memset(&part_info_cache[i], 0,
+			       sizeof(part_info_cache[i]));
+			ffa_partition_info_regs_get_part_info(
+				&ret, i - start_idx, &part_info_cache[i]);
+		}
+
+		tag = ffa_partition_info_regs_get_tag(ret);
+		start_idx = curr_idx + 1U;
+	} while (start_idx <= last_idx);
+
+	part_info_cache_count = last_idx + 1U;
+
+	return true;
+}
+
+/*
+ * Fill the cache with FFA_PARTITION_INFO_GET, through the RX buffer. The image
+ * UUID and FF-A version are cleared, as FFA_PARTITION_INFO_GET_REGS doesn't
+ * return them, for the cache to hold the same whichever ABI filled it.
+ */
+static bool ffa_partition_info_cache_fill_rx(struct mailbox_buffers *mb)
+{
+	bool result = true;
+	struct ffa_value ret = ffa_partition_info_get(NULL_UUID);
+	uint32_t count;
+
+	if (ffa_func_id(ret) != FFA_SUCCESS_SMC32) {
+		return false;
+	}
+
+	count = ffa_partition_info_count(ret);
+
+	if (ffa_partition_info_desc_size(ret) !=
+	    sizeof(struct ffa_partition_info)) {
+		ERROR("Unexpected partition info descriptor size %d\n",
+		      ffa_partition_info_desc_size(ret));
+		result = false;
+	} else if (count > FFA_PARTITION_INFO_CACHE_MAX) {
+		ERROR("Too many partitions to cache %u\n", count);
+		result = false;
+	} else {
+		memcpy(part_info_cache, mb->recv,
+		       count * sizeof(struct ffa_partition_info));
+		for (uint32_t i = 0U; i < count; i++) {
+			part_info_cache[i].image_uuid = NULL_UUID;
+			part_info_cache[i].ffa_version = 0U;
+			part_info_cache[i].reserved_0 = 0U;
+		}
+		part_info_cache_count = count;
+	}
+
+	ret = ffa_rx_release();
+	if (is_ffa_call_error(ret)) {
+		ERROR("Failed to release RX buffer\n");
+		result = false;
+	}
+
+	return result;
+}
+
+static bool ffa_partition_info_cache_populate_locked(struct mailbox_buffers *mb)
+{
+	if (part_info_cache_valid) {
+		return true;
+	}
+
+	if (!ffa_partition_info_cache_fill_regs() &&
+	    ((mb == NULL) || !ffa_partition_info_cache_fill_rx(mb))) {
+		return false;
+	}
+
+	part_info_cache_valid = true;
+
+	return true;
+}
+
+/**
+ * Populates the discovery cache, if it isn't already. The register based
+ * FFA_PARTITION_INFO_GET_REGS is used when it is supported, otherwise the
+ * information is read through the RX buffer of 'mb', if it is not NULL.
+ */
+bool ffa_partition_info_cache_populate(struct mailbox_buffers *mb)
+{
+	bool result;
+
+	spin_lock(&part_info_cache_lock);
+	result = ffa_partition_info_cache_populate_locked(mb);
+	spin_unlock(&part_info_cache_lock);
+
+	return result;
+}
+
+/**
+ * Invalidates the discovery cache, for the next lookup to discover the
+ * partitions again.
+ */
+void ffa_partition_info_cache_invalidate(void)
+{
+	spin_lock(&part_info_cache_lock);
+	part_info_cache_valid = false;
+	part_info_cache_count = 0U;
+	spin_unlock(&part_info_cache_lock);
+}
+
+/**
+ * Looks up the partitions with the given UUID, or all of them for the NULL
+ * UUID, in the discovery cache, which is populated first if needed. The number
+ * of partitions found is returned in 'count', and the information of up to
+ * 'info_max' of them is copied to 'info'. Unlike FFA_PARTITION_INFO_GET, the
+ * descriptors always hold the UUID of the partition, but their image UUID and
+ * FF-A version are always zero. Returns false if the cache couldn't be
+ * populated.
+ */
+bool ffa_partition_info_cache_get(struct mailbox_buffers *mb,
+				  const struct ffa_uuid uuid,
+				  struct ffa_partition_info *info,
+				  uint32_t info_max, uint32_t *count)
+{
+	bool any = ffa_uuid_equal(uuid, NULL_UUID);
+
+	spin_lock(&part_info_cache_lock);
+
+	if (!ffa_partition_info_cache_populate_locked(mb)) {
+		spin_unlock(&part_info_cache_lock);
+		return false;
+	}
+
+	*count = 0U;
+
+	for (uint32_t i = 0U; i < part_info_cache_count; i++) {
+		if (!any && !ffa_uuid_equal(part_info_cache[i].protocol_uuid,
+					    uuid)) {
+			continue;
+		}
+
+		if ((info != NULL) && (*count < info_max)) {
+			info[*count] = part_info_cache[i];
+		}
+		(*count)++;
+	}
+
+	spin_unlock(&part_info_cache_lock);
+
+	return true;
+}
+
+/**
+ * Looks up a UUID in the discovery cache and checks the partitions found
+ * against the target.
+ */
+bool ffa_partition_info_cache_helper(struct mailbox_buffers *mb,
+				     const struct ffa_uuid uuid,
+				     const struct ffa_partition_info *expected,
+				     const uint16_t expected_size)
+{
+	struct ffa_partition_info info[FFA_PARTITION_INFO_CACHE_MAX];
+	bool result = true;
+	uint32_t count;
+
+	if (!ffa_partition_info_cache_get(mb, uuid, info, ARRAY_SIZE(info),
+					  &count)) {
+		ERROR("Failed to populate the partition info cache\n");
+		return false;
+	}
+
+	if (count != expected_size) {
+		ERROR("Unexpected number of partitions %d\n", count);
+		return false;
+	}
+
+	/* The cached descriptors are compared as if the NULL UUID was used */
+	for (unsigned int i = 0U; i < expected_size; i++) {
+		if (!ffa_compare_partition_info(NULL_UUID, &info[i],
+						&expected[i])) {
+			result = false;
+		}
+	}
+
+	return result;
+}
+
 static bool configure_trusted_wdog_interrupt(ffa_id_t source, ffa_id_t dest,
 				bool enable)
 {
@@ -927,19 +1157,21 @@ struct ffa_memory_access ffa_memory_access_init_permissions_from_mem_func(
 
 /**
  * Receives message from the mailbox, copies it into the 'buffer', gets the
- * pending framework notifications and releases the RX buffer.
+ * pending framework notifications and releases the RX buffer. The message is
+ * read in place with indirect_message_rx_borrow(), and the RX buffer is
+ * released even if the message is malformed.
  * Returns false if it fails to copy the message to `buffer`, or true
  * otherwise.
  */
 bool receive_indirect_message(void *buffer, size_t buffer_size, void *recv,
 			      ffa_id_t *sender, ffa_id_t receiver, ffa_id_t own_id)
 {
-	const struct ffa_partition_msg *message;
-	struct ffa_partition_rxtx_header header;
+	ffa_notification_bitmap_t fwk_notif;
 	ffa_id_t source_vm_id;
-	const uint32_t *payload;
+	const void *payload;
+	size_t payload_size;
 	struct ffa_value ret;
-	ffa_notification_bitmap_t fwk_notif;
+	bool copied = false;
 
 	if (buffer_size > FFA_MSG_PAYLOAD_MAX) {
 		return false;
@@ -958,46 +1190,28 @@ bool receive_indirect_message(void *buffer, size_t buffer_size, void *recv,
 		return false;
 	}
 
-	message = (const struct ffa_partition_msg *)recv;
-	memcpy(&header, message, sizeof(struct ffa_partition_rxtx_header));
-
-	source_vm_id = header.sender;
-
-	if (is_ffa_spm_buffer_full_notification(fwk_notif)) {
-		/*
-		 * Expect the sender to always have been an SP.
-		 */
-		assert(IS_SP_ID(source_vm_id));
-	}
-
-	if (header.size > buffer_size) {
-		ERROR("Error in rxtx header. Message size: %#x; "
-		      "buffer size: %lu\n",
-		      header.size, buffer_size);
-		return false;
-	}
-
-	payload = (const uint32_t *)message->payload;
-
-	/* Get message to free the RX buffer. */
-	memcpy(buffer, payload, header.size);
-
-	/* Check receiver ID against own ID. */
-	if (receiver != own_id) {
-		ret = ffa_rx_release_with_id(receiver);
-	} else {
-		ret = ffa_rx_release();
-	}
+	payload = indirect_message_rx_borrow(recv, receiver, &source_vm_id,
+					     &payload_size);
+	if (payload != NULL) {
+		if (is_ffa_spm_buffer_full_notification(fwk_notif)) {
+			/*
+			 * Expect the sender to always have been an SP.
+			 */
+			assert(IS_SP_ID(source_vm_id));
+		}
 
-	if (is_ffa_call_error(ret)) {
-		ERROR("Failed to release the rx buffer\n");
-		return false;
+		if (payload_size > buffer_size) {
+			ERROR("Error in rxtx header. Message size: %#lx; "
+			      "buffer size: %lu\n",
+			      payload_size, buffer_size);
+		} else {
+			/* Get message to free the RX buffer. */
+			memcpy(buffer, payload, payload_size);
+			copied = true;
+		}
 	}
 
-	if (receiver != header.receiver) {
-		ERROR("Header receiver: %#x different than expected receiver: "
-		      "%#x\n",
-		      header.receiver, receiver);
+	if (!indirect_message_rx_release(receiver, own_id) || !copied) {
 		return false;
 	}
 
@@ -1028,3 +1242,85 @@ struct ffa_value send_indirect_message(
 	/* Send the message. */
 	return ffa_msg_send2(send_flags);
 }
+
+/**
+ * Initializes the `ffa_rxtx_header` of an indirect message of `payload_size`
+ * bytes in the TX buffer, and returns where the payload is to be written in
+ * it, or NULL if the payload doesn't fit. The message is then sent with
+ * FFA_MSG_SEND2, without copying the payload from another buffer.
+ */
+void *indirect_message_tx_reserve(ffa_id_t from, ffa_id_t to, void *send,
+				  size_t payload_size)
+{
+	struct ffa_partition_msg *message = (struct ffa_partition_msg *)send;
+
+	if (payload_size > FFA_PARTITION_MSG_PAYLOAD_MAX) {
+		ERROR("Indirect message payload too large: %lu\n",
+		      payload_size);
+		return NULL;
+	}
+
+	ffa_rxtx_header_init(from, to, payload_size, &message->header);
+
+	return message->payload;
+}
+
+/**
+ * Checks the header of the indirect message in the RX buffer, and returns a
+ * pointer to its payload within the RX buffer, for the caller to parse in
+ * place. The payload is valid until indirect_message_rx_release() is called.
+ * Returns NULL if the message isn't addressed to `receiver` or its header is
+ * malformed.
+ */
+const void *indirect_message_rx_borrow(const void *recv, ffa_id_t receiver,
+				       ffa_id_t *sender, size_t *payload_size)
+{
+	const struct ffa_partition_rxtx_header *header =
+		(const struct ffa_partition_rxtx_header *)recv;
+
+	if ((header->offset < FFA_RXTX_HEADER_SIZE) ||
+	    (header->offset > FFA_MSG_PAYLOAD_MAX) ||
+	    (header->size > (FFA_MSG_PAYLOAD_MAX - header->offset))) {
+		ERROR("Error in rxtx header. Offset: %#x; size: %#x\n",
+		      header->offset, header->size);
+		return NULL;
+	}
+
+	if (header->receiver != receiver) {
+		ERROR("Header receiver: %#x different than expected receiver: "
+		      "%#x\n", header->receiver, receiver);
+		return NULL;
+	}
+
+	if (sender != NULL) {
+		*sender = header->sender;
+	}
+
+	if (payload_size != NULL) {
+		*payload_size = header->size;
+	}
+
+	return (const uint8_t *)recv + header->offset;
+}
+
+/**
+ * Releases the RX buffer of `receiver` once the message borrowed with
+ * indirect_message_rx_borrow() has been consumed.
+ */
+bool indirect_message_rx_release(ffa_id_t receiver, ffa_id_t own_id)
+{
+	struct ffa_value ret;
+
+	if (receiver != own_id) {
+		ret = ffa_rx_release_with_id(receiver);
+	} else {
+		ret = ffa_rx_release();
+	}
+
+	if (is_ffa_call_error(ret)) {
+		ERROR("Failed to release the rx buffer\n");
+		return false;
+	}
+
+	return true;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,6 +13,12 @@
 
 static struct mailbox_buffers test_mb = {.send = NULL, .recv = NULL};
 
+/* Backing storage of the global mailbox, large enough for any page count */
+static struct {
+	uint8_t rx[TFTF_MAILBOX_MAX_PAGES * PAGE_SIZE];
+	uint8_t tx[TFTF_MAILBOX_MAX_PAGES * PAGE_SIZE];
+} __aligned(PAGE_SIZE) test_mb_buffers;
+
 bool reset_tftf_mailbox(void)
 {
 	if (is_ffa_call_error(ffa_rxtx_unmap())) {
@@ -21,17 +27,47 @@ bool reset_tftf_mailbox(void)
 
 	test_mb.send = NULL;
 	test_mb.recv = NULL;
+	test_mb.size = 0U;
 
 	return true;
 }
 
-bool get_tftf_mailbox(struct mailbox_buffers *mb)
+bool configure_tftf_mailbox(uint32_t page_count)
 {
 	struct ffa_value ret;
 
+	if ((page_count == 0U) || (page_count > TFTF_MAILBOX_MAX_PAGES)) {
+		ERROR("Invalid mailbox page count %u\n", page_count);
+		return false;
+	}
+
+	if (test_mb.recv != NULL && test_mb.send != NULL) {
+		if (test_mb.size == (page_count * PAGE_SIZE)) {
+			return true;
+		}
+
+		if (!reset_tftf_mailbox()) {
+			return false;
+		}
+	}
+
+	ret = ffa_rxtx_map((uintptr_t)test_mb_buffers.tx,
+			   (uintptr_t)test_mb_buffers.rx, page_count);
+	if (is_ffa_call_error(ret)) {
+		return false;
+	}
+
+	test_mb.send = (void *)test_mb_buffers.tx;
+	test_mb.recv = (void *)test_mb_buffers.rx;
+	test_mb.size = page_count * PAGE_SIZE;
+
+	return true;
+}
+
+bool get_tftf_mailbox(struct mailbox_buffers *mb)
+{
 	if (test_mb.recv == NULL || test_mb.send == NULL) {
-		CONFIGURE_AND_MAP_MAILBOX(test_mb, PAGE_SIZE, ret);
-		if (is_ffa_call_error(ret)) {
+		if (!configure_tftf_mailbox(1U)) {
 			return false;
 		}
 	}
@@ -63,6 +99,7 @@ test_result_t check_spmc_testing_set_up(
 	const struct ffa_uuid *ffa_uuids, size_t ffa_uuids_size)
 {
 	struct  mailbox_buffers mb;
+	uint32_t count;
 
 	if (ffa_uuids == NULL) {
 		ERROR("Invalid parameter ffa_uuids!\n");
@@ -82,8 +119,21 @@ test_result_t check_spmc_testing_set_up(
 
 	GET_TFTF_MAILBOX(mb);
 
-	for (unsigned int i = 0U; i < ffa_uuids_size; i++)
-		SKIP_TEST_IF_FFA_ENDPOINT_NOT_DEPLOYED(*mb, ffa_uuids[i]);
+	/*
+	 * Look the endpoints up in the discovery cache, so that every test
+	 * doesn't query the SPMC for them again. Fall back to querying the
+	 * SPMC if the cache can't be populated.
+	 */
+	for (unsigned int i = 0U; i < ffa_uuids_size; i++) {
+		if (!ffa_partition_info_cache_get(&mb, ffa_uuids[i], NULL, 0U,
+						  &count)) {
+			SKIP_TEST_IF_FFA_ENDPOINT_NOT_DEPLOYED(mb,
+							       ffa_uuids[i]);
+		} else if (count == 0U) {
+			tftf_testcase_printf("FFA endpoint not deployed!\n");
+			return TEST_RESULT_SKIPPED;
+		}
+	}
 
 	return TEST_RESULT_SUCCESS;
 }
@@ -193,3 +193,75 @@ test_result_t test_ffa_physical_arch_timer_nwd_set_swd_preempt(void)
 
 	return TEST_RESULT_SUCCESS;
 }
+
+#define LATENCY_ITERATIONS	16U
+#define LATENCY_DEADLINE_MS	1U
+#define LATENCY_WAIT_MS		5U
+
+/**
+ * Measure the delivery latency of the secure arch timer interrupt, from the
+ * deadline programmed by the SP to the entry in the SP's interrupt handler.
+ * Both timestamps are taken by the SP from the system counter, so the result
+ * covers the path through EL3 and the SPMC down to the secure virtual
+ * interrupt being taken by the SP.
+ */
+test_result_t test_ffa_arch_timer_irq_latency(void)
+{
+	struct ffa_value ret_values;
+	uint64_t raised, handled, latency;
+	uint64_t min = UINT64_MAX, max = 0U, sum = 0U;
+	uint64_t freq = read_cntfrq_el0();
+
+	CHECK_SPMC_TESTING_SETUP(1, 2, expected_sp_uuids);
+
+	for (unsigned int i = 0U; i < LATENCY_ITERATIONS; i++) {
+		/*
+		 * The SP waits for longer than the deadline, so that it
+		 * handles the timer interrupt before responding.
+		 */
+		ret_values = cactus_send_arch_timer_cmd(SENDER, RECEIVER,
+							LATENCY_DEADLINE_MS,
+							LATENCY_WAIT_MS);
+		if (!is_ffa_direct_response(ret_values) ||
+		    (cactus_get_response(ret_values) != CACTUS_SUCCESS)) {
+			ERROR("Failed to program the SP arch timer\n");
+			return TEST_RESULT_FAIL;
+		}
+
+		ret_values = cactus_get_last_interrupt_latency_cmd(SENDER,
+								   RECEIVER);
+		if (!is_ffa_direct_response(ret_values) ||
+		    (cactus_get_response(ret_values) != CACTUS_SUCCESS)) {
+			ERROR("Failed to get the SP interrupt latency\n");
+			return TEST_RESULT_FAIL;
+		}
+
+		if (cactus_get_interrupt_id(ret_values) !=
+		    TIMER_VIRTUAL_INTID) {
+			ERROR("Arch timer interrupt not serviced by SP\n");
+			return TEST_RESULT_FAIL;
+		}
+
+		raised = cactus_get_interrupt_raised_cnt(ret_values);
+		handled = cactus_get_interrupt_handled_cnt(ret_values);
+		if (handled < raised) {
+			ERROR("SP handled the arch timer interrupt before its"
+			      " deadline\n");
+			return TEST_RESULT_FAIL;
+		}
+
+		latency = handled - raised;
+		min = MIN(min, latency);
+		max = MAX(max, latency);
+		sum += latency;
+	}
+
+	tftf_testcase_printf("SP arch timer delivery latency over %u runs: "
+			     "min %llu us, avg %llu us, max %llu us\n",
+			     LATENCY_ITERATIONS,
+			     (min * 1000000U) / freq,
+			     (sum * 1000000U) / (freq * LATENCY_ITERATIONS),
+			     (max * 1000000U) / freq);
+
+	return TEST_RESULT_SUCCESS;
+}
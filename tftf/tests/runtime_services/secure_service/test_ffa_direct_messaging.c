@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -92,6 +92,84 @@ test_result_t test_ffa_direct_messaging(void)
  * otherwise.
  * For the CACTUS_SUCCESS response, the test returns TEST_RESULT_SUCCESS.
  */
+/* Number of echo commands sent to check the command statistics */
+#define CMD_STATS_ECHO_COUNT	16U
+
+/*
+ * Get the statistics that partition 'dest' keeps for the echo command on the
+ * calling core. Return false if the request failed.
+ */
+static bool get_cactus_echo_stats(ffa_id_t dest, uint32_t *count,
+				  uint64_t *total_ticks, uint64_t *max_ticks)
+{
+	struct ffa_value ret;
+
+	ret = cactus_get_cmd_stats_send_cmd(HYP_ID, dest, CACTUS_ECHO_CMD);
+	if (!is_ffa_direct_response(ret) ||
+	    (cactus_get_response(ret) != CACTUS_SUCCESS)) {
+		ERROR("Failed to get the echo statistics of SP %x\n", dest);
+		return false;
+	}
+
+	*count = cactus_get_cmd_stats_count(ret);
+	*total_ticks = cactus_get_cmd_stats_total_ticks(ret);
+	*max_ticks = cactus_get_cmd_stats_max_ticks(ret);
+
+	return true;
+}
+
+/*
+ * @Test_Aim@ Check the command handler statistics kept by the partitions
+ *
+ * Read the statistics of the echo command from each Cactus partition, send it
+ * a known number of echo commands and read them again. The count must have
+ * grown by the number of commands sent, the total time must have grown, and
+ * the longest handling time can't be greater than the total one.
+ */
+test_result_t test_ffa_direct_msg_cmd_stats(void)
+{
+	uint64_t total_before, max_before, total_after, max_after;
+	uint32_t count_before, count_after;
+
+	CHECK_SPMC_TESTING_SETUP(1, 0, expected_sp_uuids);
+
+	for (unsigned int i = 0U; i < ARRAY_SIZE(expected_sp_uuids); i++) {
+		ffa_id_t dest = SP_ID(i + 1U);
+
+		if (!get_cactus_echo_stats(dest, &count_before, &total_before,
+					   &max_before)) {
+			return TEST_RESULT_FAIL;
+		}
+
+		for (unsigned int j = 0U; j < CMD_STATS_ECHO_COUNT; j++) {
+			if (send_cactus_echo_cmd(HYP_ID, dest, ECHO_VAL1 + j) !=
+			    TEST_RESULT_SUCCESS) {
+				return TEST_RESULT_FAIL;
+			}
+		}
+
+		if (!get_cactus_echo_stats(dest, &count_after, &total_after,
+					   &max_after)) {
+			return TEST_RESULT_FAIL;
+		}
+
+		if ((count_after - count_before) != CMD_STATS_ECHO_COUNT) {
+			ERROR("SP %x: %u echo commands counted, expected %u\n",
+			      dest, count_after - count_before,
+			      CMD_STATS_ECHO_COUNT);
+			return TEST_RESULT_FAIL;
+		}
+
+		if ((total_after <= total_before) || (max_after < max_before) ||
+		    (max_after > total_after)) {
+			ERROR("SP %x: inconsistent echo handler ticks\n", dest);
+			return TEST_RESULT_FAIL;
+		}
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
+
 static test_result_t send_cactus_req_echo_cmd(ffa_id_t sender,
 					      ffa_id_t dest,
 					      ffa_id_t echo_dest,
@@ -316,6 +316,53 @@ test_result_t test_mem_lend_sp(void)
 				   constituents_count, true);
 }
 
+/**
+ * Share pages given in no particular order, turned into as few constituents
+ * as possible by ffa_memory_constituents_from_pages().
+ */
+test_result_t test_mem_share_sp_scattered_pages(void)
+{
+	uintptr_t pages[] = {
+		(uintptr_t)four_share_pages + (2U * PAGE_SIZE),
+		(uintptr_t)share_page,
+		(uintptr_t)four_share_pages,
+		(uintptr_t)four_share_pages + (3U * PAGE_SIZE),
+		(uintptr_t)four_share_pages + PAGE_SIZE,
+	};
+	struct ffa_memory_region_constituent constituents[ARRAY_SIZE(pages)];
+	uint32_t constituents_count;
+	uint32_t page_count = 0U;
+
+	constituents_count = ffa_memory_constituents_from_pages(
+		constituents, ARRAY_SIZE(constituents), pages,
+		ARRAY_SIZE(pages));
+
+	/* The four consecutive pages must have been merged. */
+	if ((constituents_count == 0U) || (constituents_count > 2U)) {
+		ERROR("Pages coalesced into %u constituents\n",
+		      constituents_count);
+		return TEST_RESULT_FAIL;
+	}
+
+	for (uint32_t i = 0U; i < constituents_count; i++) {
+		if ((i != 0U) && (constituents[i].address <=
+				  constituents[i - 1U].address)) {
+			ERROR("Constituents are not sorted\n");
+			return TEST_RESULT_FAIL;
+		}
+		page_count += constituents[i].page_count;
+	}
+
+	if (page_count != ARRAY_SIZE(pages)) {
+		ERROR("Constituents cover %u pages instead of %zu\n",
+		      page_count, ARRAY_SIZE(pages));
+		return TEST_RESULT_FAIL;
+	}
+
+	return test_memory_send_sp(FFA_MEM_SHARE_SMC64, RECEIVER, constituents,
+				   constituents_count, true);
+}
+
 test_result_t test_mem_donate_sp(void)
 {
 	struct ffa_memory_region_constituent constituents[] = {
@@ -540,9 +587,10 @@ test_result_t test_mem_share_to_sp_clear_memory(void)
 		return TEST_RESULT_FAIL;
 	}
 
-	handle = memory_send(mb.send, FFA_MEM_LEND_SMC64, constituents,
-			     constituents_count, remaining_constituent_count,
-			     fragment_length, total_length, &ret);
+	handle = memory_send(mb.send, MAILBOX_SIZE, FFA_MEM_LEND_SMC64,
+			     constituents, constituents_count,
+			     remaining_constituent_count, fragment_length,
+			     total_length, &ret);
 
 	if (handle == FFA_MEMORY_HANDLE_INVALID) {
 		ERROR("Memory Share failed!\n");
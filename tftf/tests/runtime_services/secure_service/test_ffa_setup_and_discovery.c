@@ -717,3 +717,34 @@ test_result_t test_ffa_partition_info(void)
 
 	return TEST_RESULT_SUCCESS;
 }
+
+/**
+ * Check that the partition information held by the discovery cache matches
+ * the one returned by the SPMC, for individual partitions as well as for all
+ * of them, before and after the cache is invalidated.
+ */
+test_result_t test_ffa_partition_info_cache(void)
+{
+	CHECK_SPMC_TESTING_SETUP(1, 1, sp_uuids);
+
+	GET_TFTF_MAILBOX(mb);
+
+	for (unsigned int i = 0U; i < 2U; i++) {
+		for (unsigned int j = 0U; j < 3U; j++) {
+			if (!ffa_partition_info_cache_helper(&mb, sp_uuids[j],
+				&ffa_expected_partition_info[j], 1)) {
+				return TEST_RESULT_FAIL;
+			}
+		}
+
+		if (!ffa_partition_info_cache_helper(&mb, NULL_UUID,
+			ffa_expected_partition_info,
+			ARRAY_SIZE(ffa_expected_partition_info))) {
+			return TEST_RESULT_FAIL;
+		}
+
+		ffa_partition_info_cache_invalidate();
+	}
+
+	return TEST_RESULT_SUCCESS;
+}
@@ -0,0 +1,11 @@
+#
+# Copyright (c) 2026, Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+TESTS_SOURCES	+=	$(addprefix tftf/tests/performance_tests/,	\
+	perf_stats.c							\
+	test_irq_latency.c						\
+	test_lpi_throughput.c						\
+)
@@ -1,10 +1,12 @@
 #
-# Copyright (c) 2018-2019, Arm Limited. All rights reserved.
+# Copyright (c) 2018-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
 
 TESTS_SOURCES	+=	$(addprefix tftf/tests/performance_tests/,	\
+	perf_stats.c							\
 	smc_latencies.c							\
+	test_libc_perf.c						\
 	test_psci_latencies.c						\
 )
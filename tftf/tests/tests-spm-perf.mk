@@ -0,0 +1,24 @@
+#
+# Copyright (c) 2026, Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+include tftf/tests/tests-spm.mk
+
+TESTS_SOURCES	+=	$(addprefix tftf/tests/performance_tests/,	\
+	perf_stats.c							\
+	test_ffa_direct_msg_perf.c					\
+	test_ffa_indirect_msg_perf.c					\
+	test_ffa_mem_share_perf.c					\
+	test_ffa_notifications_perf.c					\
+	test_ffa_partition_info_perf.c					\
+	test_ffa_preemption_perf.c					\
+	test_ffa_stress.c						\
+)
+
+ifeq (${ARCH},aarch64)
+TESTS_SOURCES	+=	$(addprefix tftf/tests/performance_tests/,	\
+	test_ffa_smccc_perf.c						\
+)
+endif
@@ -9,6 +9,7 @@
 #include <debug.h>
 #include <errno.h>
 #include <platform_def.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 #include <tftf_lib.h>
@@ -858,3 +859,135 @@ test_result_t xlat_lib_v2_stress_test(void)
 
 	return test_result;
 }
+
+/*
+ * Checks that the Contiguous hint of the page descriptors that map the region
+ * [base_va, base_va + size) is set or cleared as expected.
+ */
+static int verify_cont_hint(uintptr_t base_va, size_t size, bool expected)
+{
+	uint64_t desc;
+	int rc;
+
+	for (uintptr_t va = base_va; va < (base_va + size); va += PAGE_SIZE) {
+		rc = xlat_get_desc(va, &desc);
+		if (rc != 0) {
+			tftf_testcase_printf("%d: xlat_get_desc(0x%lx): %d\n",
+					     __LINE__, va, rc);
+			return -1;
+		}
+
+		if (((desc & UPPER_ATTRS(CONT_HINT)) != 0ULL) != expected) {
+			tftf_testcase_printf("0x%lx: Contiguous hint %s\n", va,
+					     expected ? "not set" : "set");
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @Test_Aim@ Change the attributes of pages mapped with the Contiguous hint
+ *
+ * This test maps a region that is big enough to be described by groups of
+ * contiguous page descriptors, checks that the hint is set on them, changes
+ * the attributes of a page in the middle of one of these groups and checks
+ * that the hint has been cleared on that group only and that the rest of the
+ * region is still mapped correctly.
+ */
+test_result_t xlat_lib_v2_contiguous_test(void)
+{
+	uintptr_t memory_base;
+	uintptr_t page_va;
+	size_t size, tail;
+	uint32_t attr;
+	int rc;
+
+	/*
+	 * 1) Try to allocate an invalid region. It should fail, but it will
+	 * return the address of memory that can be used for the following
+	 * tests.
+	 */
+	rc = add_region_alloc_va(0, &memory_base, SIZE_MAX, MT_DEVICE);
+	if (rc == 0) {
+		tftf_testcase_printf("%d: add_region_alloc_va() didn't fail\n",
+				     __LINE__);
+		return TEST_RESULT_FAIL;
+	}
+
+	memory_base = (memory_base + SIZE_L1 - 1UL) & ~MASK_L1;
+
+	INFO("Using 0x%lx as base address for tests.\n", memory_base);
+
+	/*
+	 * 2) Map a region that needs a level 3 table because of its size, but
+	 * that is aligned so that most of it can use contiguous groups.
+	 */
+	size = SIZE_L2 - SIZE_L3;
+	rc = add_region(memory_base, memory_base, size,
+			MT_DEVICE | MT_RW | MT_EXECUTE_NEVER);
+	if (rc != 0) {
+		tftf_testcase_printf("%d: add_region: %d\n", __LINE__, rc);
+		return TEST_RESULT_FAIL;
+	}
+
+	/*
+	 * All the complete groups of the region must be contiguous. The last
+	 * one is a page short, so it must not be.
+	 */
+	tail = size % XLAT_CONT_SIZE(3U);
+	if ((verify_cont_hint(memory_base, size - tail, true) != 0) ||
+	    (verify_cont_hint(memory_base + size - tail, tail, false) != 0)) {
+		return TEST_RESULT_FAIL;
+	}
+
+	/* 3) Make a page in the middle of the second group read-only. */
+	page_va = memory_base + XLAT_CONT_SIZE(3U) + (2U * PAGE_SIZE);
+	rc = xlat_change_mem_attributes(page_va, PAGE_SIZE,
+					MT_RO | MT_EXECUTE_NEVER);
+	if (rc != 0) {
+		tftf_testcase_printf("%d: xlat_change_mem_attributes: %d\n",
+				     __LINE__, rc);
+		return TEST_RESULT_FAIL;
+	}
+
+	rc = xlat_get_mem_attributes(page_va, &attr);
+	if ((rc != 0) || ((attr & MT_RW) != 0U)) {
+		tftf_testcase_printf("%d: Page still read-write (%d)\n",
+				     __LINE__, rc);
+		return TEST_RESULT_FAIL;
+	}
+
+	rc = xlat_get_mem_attributes(page_va + PAGE_SIZE, &attr);
+	if ((rc != 0) || ((attr & MT_RW) == 0U)) {
+		tftf_testcase_printf("%d: Neighbour page not read-write (%d)\n",
+				     __LINE__, rc);
+		return TEST_RESULT_FAIL;
+	}
+
+	/*
+	 * 4) The hint must have been cleared on the whole second group only,
+	 * and the rest of the region must not have been affected.
+	 */
+	if ((verify_cont_hint(memory_base, XLAT_CONT_SIZE(3U), true) != 0) ||
+	    (verify_cont_hint(memory_base + XLAT_CONT_SIZE(3U),
+			      XLAT_CONT_SIZE(3U), false) != 0) ||
+	    (verify_cont_hint(memory_base + (2U * XLAT_CONT_SIZE(3U)),
+			      size - tail - (2U * XLAT_CONT_SIZE(3U)),
+			      true) != 0)) {
+		return TEST_RESULT_FAIL;
+	}
+
+	if (verify_region_mapped(memory_base, memory_base, size) != 0) {
+		return TEST_RESULT_FAIL;
+	}
+
+	rc = remove_region(memory_base, size);
+	if (rc != 0) {
+		tftf_testcase_printf("%d: remove_region: %d\n", __LINE__, rc);
+		return TEST_RESULT_FAIL;
+	}
+
+	return TEST_RESULT_SUCCESS;
+}